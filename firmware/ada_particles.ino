@@ -23,6 +23,11 @@
 
 #include "config.h"
 #include "src/particle_system.h"
+#include "src/command_queue.h"
+#include "src/memory_arena.h"
+#include "src/profiler.h"
+#include "src/server_messages.h"
+#include "src/message_log.h"
 
 using namespace websockets;
 
@@ -43,92 +48,150 @@ Arduino_GFX* gfx = new Arduino_CO5300(
 // WebSocket Client
 // ============================================
 
+// Owned by the network task
 WebsocketsClient wsClient;
-bool wsConnected = false;
+volatile bool wsConnected = false;
 unsigned long lastReconnectAttempt = 0;
+bool wifiUp = false;                    // WiFi was connected at the last check
 unsigned long lastPing = 0;
+uint8_t reportedQualityLevel = 0xFF;    // None sent yet on this connection
+unsigned long lastStatsReport = 0;
+
+#ifdef MESSAGE_LOG
+MessageLog messageLog;
+MessageReplay replay;
+#endif
 
 // ============================================
-// Timing
+// Tasks
 // ============================================
 
-unsigned long lastFrameTime = 0;
+// Network task -> render task
+CommandQueue<COMMAND_QUEUE_SIZE> commandQueue;
+
+TaskHandle_t networkTask = nullptr;
+TaskHandle_t renderTask = nullptr;
+
+// Owned by the render task
+uint32_t lastFrameUs = 0;
 unsigned long lastStatusReport = 0;
 
+/**
+ * Hand a command to the render task.
+ * Waits for space rather than dropping state changes.
+ */
+void sendCommand(const Command& cmd) {
+    while (!commandQueue.push(cmd)) {
+        vTaskDelay(1);
+    }
+}
+
 // ============================================
-// WebSocket Handlers
+// Server Reports (network task)
 // ============================================
 
-void onWebSocketMessage(WebsocketsMessage message) {
-    if (message.isBinary()) {
-        // Binary messages not used in native mode
-        return;
+/**
+ * Introduce the display, including every quality level it can fall
+ * back to, so the server can plan content for the current one.
+ */
+void sendHello() {
+    StaticJsonDocument<768> doc;
+    doc["type"] = "hello";
+    doc["mode"] = "native";
+    doc["width"] = SCREEN_WIDTH;
+    doc["height"] = SCREEN_HEIGHT;
+    
+    JsonArray levels = doc.createNestedArray("quality_levels");
+    for (uint8_t i = 0; i < QUALITY_LEVEL_COUNT; i++) {
+        const QualityLevel& q = ParticleSystem::getQualityLevelInfo(i);
+        JsonObject level = levels.createNestedObject();
+        level["max_particles"] = q.maxParticles;
+        level["max_size"] = q.maxSizeIdx;
+        level["fade"] = q.fade256 / 256.0f;
     }
     
-    // Parse JSON state message
-    StaticJsonDocument<512> doc;
-    DeserializationError error = deserializeJson(doc, message.data());
+    String out;
+    serializeJson(doc, out);
+    wsClient.send(out);
+}
+
+/**
+ * Report the quality level the render task is running at.
+ */
+void sendQualityReport(uint8_t level) {
+    StaticJsonDocument<128> doc;
+    doc["type"] = "quality";
+    doc["level"] = level;
+    doc["fps"] = particleSystem.getFPS();
+    doc["frame_ms"] = particleSystem.getFrameTimeMs();
+    
+    String out;
+    serializeJson(doc, out);
+    wsClient.send(out);
+}
+
+#ifdef DEBUG_ENABLED
+/**
+ * Report per-stage timings: [min, avg, p99, max] in microseconds
+ * over each stage's last PROFILE_SAMPLES samples.
+ */
+void sendStats() {
+    StaticJsonDocument<1024> doc;
+    doc["type"] = "stats";
+    doc["fps"] = particleSystem.getFPS();
     
-    if (error) {
-        DEBUG_PRINTF("JSON parse error: %s\n", error.c_str());
-        return;
+    JsonObject stages = doc.createNestedObject("stages");
+    for (uint8_t s = 0; s < PROFILE_STAGE_COUNT; s++) {
+        ProfileStats stats;
+        if (!profiler.getStats(s, stats)) continue;
+        JsonArray t = stages.createNestedArray(Profiler::stageName(s));
+        t.add(stats.minUs);
+        t.add(stats.avgUs);
+        t.add(stats.p99Us);
+        t.add(stats.maxUs);
     }
     
-    String msgType = doc["type"] | "";
+    String out;
+    serializeJson(doc, out);
+    wsClient.send(out);
+}
+#endif
+
+// ============================================
+// WebSocket Handlers
+// ============================================
+
+void onWebSocketMessage(WebsocketsMessage message) {
+    const uint8_t* data = (const uint8_t*)message.c_str();
+    size_t len = message.length();
+    
+    #ifdef MESSAGE_LOG
+    // A replay owns the particle system until it ends
+    if (replay.isActive()) return;
+    messageLog.record(millis(), data, len, message.isBinary());
+    #endif
     
-    if (msgType == "state") {
-        // Mood update
-        if (doc.containsKey("mood")) {
-            float valence = doc["mood"]["valence"] | 0.0f;
-            float arousal = doc["mood"]["arousal"] | 0.3f;
-            particleSystem.setMood(valence, arousal);
-        }
-        
-        // Formation update
-        if (doc.containsKey("formation")) {
-            String formation = doc["formation"] | "idle";
-            uint16_t transitionMs = doc["transition_ms"] | DEFAULT_TRANSITION_MS;
-            
-            FormationType ft = FORMATION_IDLE;
-            if (formation == "cloud") ft = FORMATION_CLOUD;
-            else if (formation == "sun") ft = FORMATION_SUN;
-            else if (formation == "rain") ft = FORMATION_RAIN;
-            else if (formation == "snow") ft = FORMATION_SNOW;
-            else if (formation == "heart") ft = FORMATION_HEART;
-            else if (formation == "thinking") ft = FORMATION_THINKING;
-            else if (formation == "wave") ft = FORMATION_WAVE;
-            
-            particleSystem.setFormation(ft, transitionMs);
-        }
-        
-        // Particle count
-        if (doc.containsKey("particle_count")) {
-            int count = doc["particle_count"] | DEFAULT_PARTICLE_COUNT;
-            particleSystem.setParticleCount(count);
-        }
-    } else if (msgType == "config") {
-        // Display brightness
-        if (doc.containsKey("brightness")) {
-            int brightness = doc["brightness"] | DISPLAY_BRIGHTNESS;
-            ((Arduino_CO5300*)gfx)->setBrightness(constrain(brightness, 0, 255));
-        }
-    } else if (msgType == "pong") {
-        // Heartbeat response
-    }
+    parseServerMessage(data, len, message.isBinary(), sendCommand);
 }
 
 void onWebSocketEvent(WebsocketsEvent event, String data) {
+    Command cmd;
+    cmd.type = CMD_SET_DISCONNECTED;
+    
     if (event == WebsocketsEvent::ConnectionOpened) {
         DEBUG_PRINTLN("WebSocket connected!");
         wsConnected = true;
-        particleSystem.setDisconnected(false);
+        cmd.disconnected = false;
+        sendCommand(cmd);
         
-        // Send hello
-        wsClient.send("{\"type\":\"hello\",\"mode\":\"native\",\"width\":466,\"height\":466}");
+        // Send hello; the quality level follows from the network loop
+        sendHello();
+        reportedQualityLevel = 0xFF;
     } else if (event == WebsocketsEvent::ConnectionClosed) {
         DEBUG_PRINTLN("WebSocket disconnected");
         wsConnected = false;
-        particleSystem.setDisconnected(true);
+        cmd.disconnected = true;
+        sendCommand(cmd);
     }
 }
 
@@ -142,14 +205,42 @@ void connectWebSocket() {
     wsClient.connect(url);
 }
 
+// ============================================
+// Render Commands
+// ============================================
+
+/**
+ * Apply one command from the network task (render task only).
+ */
+void handleCommand(const Command& cmd) {
+    switch (cmd.type) {
+        case CMD_SET_MOOD:
+            particleSystem.setMood(cmd.mood.valence, cmd.mood.arousal);
+            break;
+        case CMD_SET_FORMATION:
+            particleSystem.setFormation((FormationType)cmd.formation.type,
+                                        cmd.formation.transitionMs);
+            break;
+        case CMD_SET_PARTICLE_COUNT:
+            particleSystem.setParticleCount(cmd.particleCount);
+            break;
+        case CMD_SET_DISCONNECTED:
+            particleSystem.setDisconnected(cmd.disconnected);
+            break;
+        case CMD_SET_BRIGHTNESS:
+            particleSystem.waitForDisplay();  // Bus may be mid-frame
+            ((Arduino_CO5300*)gfx)->setBrightness(cmd.brightness);
+            break;
+    }
+}
+
 // ============================================
 // Setup
 // ============================================
 
 void setup() {
     Serial.begin(115200);
-    while (!Serial && millis() < 3000) delay(10);
-    delay(100);
+    while (!Serial && millis() < SERIAL_WAIT_MS) delay(10);
     
     Serial.println("\n========================================");
     Serial.println("   Ada Particles - Starting Up");
@@ -178,6 +269,9 @@ void setup() {
     gfx->setCursor(SCREEN_CENTER_X - 60, SCREEN_CENTER_Y + 20);
     gfx->println("Initializing...");
     
+    // Reserve every subsystem's memory up front
+    memoryArena.init();
+    
     // Initialize particle system
     Serial.println("Initializing particle system...");
     if (!particleSystem.init(gfx)) {
@@ -186,34 +280,35 @@ void setup() {
         while (1) { delay(100); }
     }
     
-    // Connect to WiFi
-    Serial.printf("Connecting to WiFi: %s\n", WIFI_SSID);
-    gfx->setCursor(SCREEN_CENTER_X - 70, SCREEN_CENTER_Y + 40);
-    gfx->println("Connecting WiFi...");
-    
-    WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
-    
-    int attempts = 0;
-    while (WiFi.status() != WL_CONNECTED && attempts < 30) {
-        delay(500);
-        Serial.print(".");
-        attempts++;
+    #ifdef MESSAGE_LOG
+    if (messageLog.init()) {
+        Serial.println("Message log: d = dump, r = replay, c = clear");
     }
+    #endif
     
-    if (WiFi.status() == WL_CONNECTED) {
-        Serial.printf("\nWiFi connected! IP: %s\n", WiFi.localIP().toString().c_str());
-        connectWebSocket();
-    } else {
-        Serial.println("\nWiFi failed - running offline");
-        particleSystem.setDisconnected(true);
-    }
+    // Start WiFi without waiting for it: the network task opens the
+    // WebSocket once it is up, so the particles render right away
+    Serial.printf("Connecting to WiFi: %s\n", WIFI_SSID);
+    particleSystem.setDisconnected(true);
+    WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+    lastReconnectAttempt = millis();
     
     // Clear startup text and start rendering
     gfx->fillScreen(0x0000);
     
-    lastFrameTime = millis();
+    lastFrameUs = micros();
     lastStatusReport = millis();
     
+    // Split the work across both cores
+    xTaskCreatePinnedToCore(networkTaskLoop, "network", NETWORK_TASK_STACK,
+                            nullptr, NETWORK_TASK_PRIORITY, &networkTask,
+                            NETWORK_TASK_CORE);
+    xTaskCreatePinnedToCore(renderTaskLoop, "render", RENDER_TASK_STACK,
+                            nullptr, RENDER_TASK_PRIORITY, &renderTask,
+                            RENDER_TASK_CORE);
+    
+    memoryArena.printReport();
+    
     Serial.println("\n========================================");
     Serial.println("   Ada Particles - Ready!");
     Serial.printf("   PSRAM: %d KB free\n", ESP.getFreePsram() / 1024);
@@ -221,64 +316,173 @@ void setup() {
     Serial.println("========================================\n");
 }
 
+#ifdef MESSAGE_LOG
 // ============================================
-// Main Loop
+// Message Log Console
 // ============================================
 
-void loop() {
-    unsigned long now = millis();
-    
-    // Calculate delta time
-    float dt = (now - lastFrameTime) / 1000.0f;
-    lastFrameTime = now;
-    
-    // Clamp dt to prevent huge jumps
-    if (dt > 0.1f) dt = 0.1f;
-    
-    // Poll WebSocket
-    if (wsConnected) {
-        wsClient.poll();
+void deliverReplayed(const LoggedMessage& msg) {
+    parseServerMessage(msg.data, msg.len, msg.binary, sendCommand);
+}
+
+/**
+ * Serial commands for the message log (network task only).
+ */
+void handleConsole() {
+    while (Serial.available() > 0) {
+        switch (Serial.read()) {
+            case 'd':
+                messageLog.dump();
+                break;
+            case 'r':
+                Serial.printf("Replaying %u messages\n", (unsigned)messageLog.getCount());
+                replay.start(messageLog, millis());
+                break;
+            case 'c':
+                replay.stop();
+                messageLog.clear();
+                Serial.println("Message log cleared");
+                break;
+        }
+    }
+}
+#endif
+
+// ============================================
+// Network Task (core 0)
+// ============================================
+
+void networkTaskLoop(void* arg) {
+    for (;;) {
+        unsigned long now = millis();
         
-        // Periodic ping
-        if (now - lastPing > 10000) {
-            wsClient.send("{\"type\":\"ping\"}");
-            lastPing = now;
+        #ifdef MESSAGE_LOG
+        handleConsole();
+        if (replay.isActive() && replay.poll(now, deliverReplayed) > 0 && !replay.isActive()) {
+            Serial.println("Replay done");
         }
-    } else {
-        // Try to reconnect
-        if (now - lastReconnectAttempt > WS_RECONNECT_INTERVAL_MS) {
+        #endif
+        
+        // Poll WebSocket (message callbacks run here)
+        if (wsConnected) {
+            {
+                PROFILE_SCOPE(PROFILE_WS_POLL);
+                wsClient.poll();
+            }
+            PROFILE_COMMIT(PROFILE_NETWORK_FIRST, PROFILE_NETWORK_LAST);
+            
+            // Periodic ping
+            if (now - lastPing > 10000) {
+                wsClient.send("{\"type\":\"ping\"}");
+                lastPing = now;
+            }
+            
+            // Tell the server whenever the governor changes level
+            uint8_t level = particleSystem.getQualityLevel();
+            if (level != reportedQualityLevel) {
+                sendQualityReport(level);
+                reportedQualityLevel = level;
+            }
+            
+            #ifdef DEBUG_ENABLED
+            if (now - lastStatsReport >= PROFILE_REPORT_INTERVAL_MS) {
+                lastStatsReport = now;
+                sendStats();
+            }
+            #endif
+        } else if (WiFi.status() == WL_CONNECTED && !wifiUp) {
+            // WiFi just came up: connect now rather than next interval
+            wifiUp = true;
             lastReconnectAttempt = now;
-            if (WiFi.status() == WL_CONNECTED) {
-                connectWebSocket();
-            } else {
-                WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+            Serial.printf("WiFi connected! IP: %s\n", WiFi.localIP().toString().c_str());
+            connectWebSocket();
+        } else {
+            // Try to reconnect
+            wifiUp = WiFi.status() == WL_CONNECTED;
+            if (now - lastReconnectAttempt > WS_RECONNECT_INTERVAL_MS) {
+                lastReconnectAttempt = now;
+                if (WiFi.status() == WL_CONNECTED) {
+                    connectWebSocket();
+                } else {
+                    WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+                }
             }
         }
+        
+        vTaskDelay(1);
     }
+}
+
+// ============================================
+// Render Task (core 1)
+// ============================================
+
+void renderTaskLoop(void* arg) {
+    // Frame pacing: wake on a fixed schedule of TARGET_FPS frames per
+    // second. The period is kept in microseconds and the part under a
+    // tick carried over, so frames average 1/TARGET_FPS exactly rather
+    // than rounding to whole ticks
+    const uint32_t framePeriodUs = 1000000 / TARGET_FPS;
+    const uint32_t tickUs = 1000000 / configTICK_RATE_HZ;
+    uint32_t pendingUs = 0;
+    TickType_t lastWake = xTaskGetTickCount();
     
-    // Update particle system
-    particleSystem.update(dt);
-    
-    // Render
-    particleSystem.render();
-    
-    // Status report
-    #ifdef DEBUG_ENABLED
-    if (now - lastStatusReport >= FPS_REPORT_INTERVAL_MS) {
-        lastStatusReport = now;
-        Serial.printf("FPS: %.1f | Particles: %d | PSRAM: %d | Heap: %d | %s\n",
-            particleSystem.getFPS(),
-            particleSystem.getActiveParticles(),
-            ESP.getFreePsram(),
-            ESP.getFreeHeap(),
-            wsConnected ? "Connected" : "Disconnected"
-        );
-    }
-    #endif
-    
-    // Frame rate limiting
-    unsigned long frameTime = millis() - now;
-    if (frameTime < TARGET_FRAME_TIME_MS) {
-        delay(TARGET_FRAME_TIME_MS - frameTime);
+    for (;;) {
+        unsigned long now = millis();
+        
+        // Delta time at microsecond resolution (the particle system
+        // splits it into fixed physics steps)
+        uint32_t nowUs = micros();
+        float dt = (nowUs - lastFrameUs) / 1000000.0f;
+        lastFrameUs = nowUs;
+        
+        // Apply everything the network task has parsed
+        Command cmd;
+        while (commandQueue.pop(cmd)) {
+            handleCommand(cmd);
+        }
+        
+        // Update particle system
+        particleSystem.update(dt);
+        
+        // Render
+        particleSystem.render();
+        PROFILE_COMMIT(PROFILE_RENDER_FIRST, PROFILE_RENDER_LAST);
+        
+        // Status report
+        #ifdef DEBUG_ENABLED
+        if (now - lastStatusReport >= FPS_REPORT_INTERVAL_MS) {
+            lastStatusReport = now;
+            Serial.printf("FPS: %.1f | Frame: %.1f ms | Quality: %u | Particles: %d | Push: %u KB | Live: %u | PSRAM: %d | Heap: %d | %s\n",
+                particleSystem.getFPS(),
+                particleSystem.getFrameTimeMs(),
+                (unsigned)particleSystem.getQualityLevel(),
+                particleSystem.getActiveParticles(),
+                (unsigned)(particleSystem.getBytesPushed() / 1024),
+                (unsigned)particleSystem.getLiveTiles(),
+                ESP.getFreePsram(),
+                ESP.getFreeHeap(),
+                wsConnected ? "Connected" : "Disconnected"
+            );
+        }
+        #endif
+        
+        // Sleep until the next frame is due. A late frame starts the
+        // schedule again from now instead of rushing to catch up
+        pendingUs += framePeriodUs;
+        TickType_t ticks = pendingUs / tickUs;
+        pendingUs -= ticks * tickUs;
+        if (ticks == 0 || xTaskDelayUntil(&lastWake, ticks) == pdFALSE) {
+            lastWake = xTaskGetTickCount();
+        }
     }
 }
+
+// ============================================
+// Main Loop
+// ============================================
+
+void loop() {
+    // All work happens in the network and render tasks
+    vTaskDelete(NULL);
+}
@@ -3,20 +3,27 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <string.h>
 
 /**
  * Base64 Decoder for ESP32
  *
  * Decodes base64-encoded image data from the server.
  * Optimized for speed over memory — uses a 256-byte lookup table.
+ *
+ * Base64Decoder is incremental: feed it chunks as they arrive and it
+ * writes straight into the caller's buffer. Whole quads of alphabet
+ * characters decode four at a time with a single validity test;
+ * whitespace, padding and stray characters fall back to a
+ * per-character path.
  */
 
-// Lookup table: ASCII char → 6-bit value (255 = invalid)
+// Lookup table: ASCII char → 6-bit value (255 = invalid, including '=')
 static const uint8_t BASE64_LUT[256] = {
     255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
     255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
     255,255,255,255,255,255,255,255,255,255,255, 62,255,255,255, 63,
-     52, 53, 54, 55, 56, 57, 58, 59, 60, 61,255,255,255,  0,255,255,
+     52, 53, 54, 55, 56, 57, 58, 59, 60, 61,255,255,255,255,255,255,
     255,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
      15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,255,255,255,255,255,
     255, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
@@ -31,52 +38,143 @@ static const uint8_t BASE64_LUT[256] = {
     255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
 };
 
-/**
- * Decode base64 string to raw bytes.
- *
- * @param input   Null-terminated base64 string
- * @param output  Output buffer (must be large enough)
- * @param outLen  Set to actual decoded length on return
- * @return true on success, false on invalid input
- */
-static inline bool base64_decode(const char* input, uint8_t* output, size_t* outLen) {
-    if (!input || !output || !outLen) return false;
+class Base64Decoder {
+public:
+    Base64Decoder() { begin(nullptr, 0); }
 
-    size_t inputLen = strlen(input);
-    // Strip trailing whitespace/padding for length calculation
-    while (inputLen > 0 && (input[inputLen - 1] == '=' || input[inputLen - 1] == '\n' || input[inputLen - 1] == '\r')) {
-        inputLen--;
+    /**
+     * Start decoding into output (up to capacity bytes).
+     */
+    void begin(uint8_t* output, size_t capacity) {
+        _out = output;
+        _capacity = output ? capacity : 0;
+        _length = 0;
+        _accum = 0;
+        _pending = 0;
+        _done = false;
     }
 
-    size_t outIdx = 0;
-    uint32_t accum = 0;
-    int bits = 0;
+    /**
+     * Decode the next chunk of base64 text.
+     * Stops early at padding ('=') or when the output is full.
+     * @return Number of input characters consumed
+     */
+    size_t feed(const char* input, size_t len) {
+        size_t i = 0;
+
+        while (i < len && !_done) {
+            // Fast path: four alphabet characters -> three bytes
+            while (_pending == 0 && len - i >= 4 && _capacity - _length >= 3) {
+                uint32_t a = BASE64_LUT[(uint8_t)input[i]];
+                uint32_t b = BASE64_LUT[(uint8_t)input[i + 1]];
+                uint32_t c = BASE64_LUT[(uint8_t)input[i + 2]];
+                uint32_t d = BASE64_LUT[(uint8_t)input[i + 3]];
+                if ((a | b | c | d) & 0x80) break;
 
-    for (size_t i = 0; i < strlen(input); i++) {
-        char c = input[i];
+                uint32_t v = (a << 18) | (b << 12) | (c << 6) | d;
+                _out[_length] = (uint8_t)(v >> 16);
+                _out[_length + 1] = (uint8_t)(v >> 8);
+                _out[_length + 2] = (uint8_t)v;
+                _length += 3;
+                i += 4;
+            }
+            if (i >= len) break;
 
-        // Skip whitespace
-        if (c == '\n' || c == '\r' || c == ' ' || c == '\t') continue;
+            // Slow path: one character
+            char ch = input[i];
+            if (ch == '=') {
+                _done = true;
+                i++;
+                break;
+            }
 
-        // Stop at padding
-        if (c == '=') break;
+            uint8_t val = BASE64_LUT[(uint8_t)ch];
+            if (val == 255) {
+                // Whitespace or invalid character — skip (be lenient)
+                i++;
+                continue;
+            }
 
-        uint8_t val = BASE64_LUT[(uint8_t)c];
-        if (val == 255) {
-            // Invalid character — skip but don't fail (be lenient)
-            continue;
+            if (_pending == 3 && _capacity - _length < 3) break;  // Output full
+
+            _accum = (_accum << 6) | val;
+            i++;
+            if (++_pending == 4) {
+                _out[_length] = (uint8_t)(_accum >> 16);
+                _out[_length + 1] = (uint8_t)(_accum >> 8);
+                _out[_length + 2] = (uint8_t)_accum;
+                _length += 3;
+                _accum = 0;
+                _pending = 0;
+            }
         }
 
-        accum = (accum << 6) | val;
-        bits += 6;
+        return i;
+    }
+
+    /**
+     * Flush a trailing partial quad (2 or 3 characters, with or without
+     * padding). Call once after the last feed().
+     * @return false if the input ended mid-byte or the output overflowed
+     */
+    bool finish() {
+        bool ok = true;
 
-        if (bits >= 8) {
-            bits -= 8;
-            output[outIdx++] = (uint8_t)((accum >> bits) & 0xFF);
+        if (_pending >= 2) {
+            size_t bytes = _pending - 1;
+            uint32_t v = _accum << (6 * (4 - _pending));
+            if (_capacity - _length >= bytes) {
+                _out[_length++] = (uint8_t)(v >> 16);
+                if (bytes == 2) _out[_length++] = (uint8_t)(v >> 8);
+            } else {
+                ok = false;
+            }
+        } else if (_pending == 1) {
+            ok = false;
         }
+
+        _accum = 0;
+        _pending = 0;
+        _done = true;
+        return ok;
     }
 
-    *outLen = outIdx;
+    /**
+     * Bytes written to the output so far.
+     */
+    size_t length() const { return _length; }
+
+    /**
+     * True once padding was seen or finish() was called.
+     */
+    bool isDone() const { return _done; }
+
+private:
+    uint8_t* _out;
+    size_t _capacity;
+    size_t _length;
+    uint32_t _accum;     // Sextets of the current partial quad
+    uint8_t _pending;    // Number of sextets in _accum (0-3)
+    bool _done;
+};
+
+/**
+ * Decode base64 string to raw bytes.
+ *
+ * @param input   Null-terminated base64 string
+ * @param output  Output buffer (must be large enough)
+ * @param outLen  Set to actual decoded length on return
+ * @return true on success, false on invalid input
+ */
+static inline bool base64_decode(const char* input, uint8_t* output, size_t* outLen) {
+    if (!input || !output || !outLen) return false;
+
+    Base64Decoder decoder;
+    decoder.begin(output, SIZE_MAX);
+    decoder.feed(input, strlen(input));
+    decoder.finish();
+
+    *outLen = decoder.length();
     return true;
 }
 
@@ -0,0 +1,165 @@
+/**
+ * Ada Particles bench - sprite table baker
+ *
+ *   bake_sprites --write DIR | --check DIR
+ *
+ * Computes the particle sprites with ParticleSprites::compute() and
+ * writes them as DIR/sprite_tables.h and DIR/sprite_tables.cpp, which
+ * the firmware reads from flash instead of computing them at boot.
+ * --check fails if the files in DIR differ, so stale tables show up
+ * in ctest.
+ */
+
+#include <Arduino.h>
+#include "../src/sprites.h"
+#include <stdarg.h>
+#include <string>
+
+static std::string format(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+
+static std::string format(const char* fmt, ...) {
+    char buf[256];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    return buf;
+}
+
+// A float literal that reads back as the same float
+static std::string floatLiteral(float v) {
+    std::string s = format("%.9g", v);
+    if (s.find_first_of(".e") == std::string::npos) s += ".0";
+    return s + "f";
+}
+
+static std::string bakeHeader() {
+    std::string out =
+        "/**\n"
+        " * Ada Particles - Baked Particle Sprites\n"
+        " *\n"
+        " * Generated by bench/bake_sprites from ParticleSprites::compute();\n"
+        " * do not edit. After changing the sprite sizes, sigmas or sub-pixel\n"
+        " * phases, regenerate them with\n"
+        " *\n"
+        " *   build/bench/bake_sprites --write firmware/src\n"
+        " *\n"
+        " * Until then the firmware computes its sprites at boot, and the\n"
+        " * bench's ctest fails.\n"
+        " */\n"
+        "\n"
+        "#ifndef SPRITE_TABLES_H\n"
+        "#define SPRITE_TABLES_H\n"
+        "\n"
+        "#include <stdint.h>\n"
+        "\n"
+        "// Sprite configuration the tables were baked for\n";
+    out += format("#define SPRITE_TABLES_SUBPIXEL_SHIFT %d\n", SPRITE_SUBPIXEL_SHIFT);
+
+    out += format("static constexpr uint8_t SPRITE_TABLES_DIAMETER[%d] = {", NUM_PARTICLE_SIZES);
+    for (int i = 0; i < NUM_PARTICLE_SIZES; i++) {
+        out += format("%s %d", i ? "," : "", particleSprites.getSpriteSize(i));
+    }
+    out += format(" };\nstatic constexpr float SPRITE_TABLES_SIGMA[%d] = {", NUM_PARTICLE_SIZES);
+    for (int i = 0; i < NUM_PARTICLE_SIZES; i++) {
+        out += format("%s %s", i ? "," : "", floatLiteral(SPRITE_SCALED_SIGMA(i)).c_str());
+    }
+    out += " };\n\n#endif // SPRITE_TABLES_H\n";
+    return out;
+}
+
+static std::string bakeSource() {
+    std::string out =
+        "/**\n"
+        " * Ada Particles - Baked Particle Sprites (generated by\n"
+        " * bench/bake_sprites; do not edit)\n"
+        " */\n"
+        "\n"
+        "#include \"sprites.h\"\n";
+
+    for (int i = 0; i < NUM_PARTICLE_SIZES; i++) {
+        uint8_t grid = SPRITE_GRID(particleSprites.getSpriteSize(i));
+        int texels = grid * grid * SPRITE_PHASES;
+        int rows = grid * SPRITE_PHASES;
+        const uint8_t* alpha = particleSprites.getSprite(i);
+        const SpriteSpan* spans = particleSprites.getSpans(i);
+
+        out += format("\n// Size %d: %dx%d, %d phases\n", i, grid, grid, SPRITE_PHASES);
+        out += format("static const uint8_t ALPHA_%d[%d] PROGMEM = {\n", i, texels);
+        for (int t = 0; t < texels; t++) {
+            out += format("%s%3u,%s", t % 16 ? " " : "    ", alpha[t], (t % 16 == 15 || t == texels - 1) ? "\n" : "");
+        }
+        out += "};\n\n";
+
+        out += format("static const SpriteSpan SPANS_%d[%d] PROGMEM = {\n", i, rows);
+        for (int r = 0; r < rows; r++) {
+            out += format("%s{ %2u, %2u },%s", r % 8 ? " " : "    ", spans[r].start, spans[r].length,
+                          (r % 8 == 7 || r == rows - 1) ? "\n" : "");
+        }
+        out += "};\n";
+    }
+
+    out += "\nconst uint8_t* const SPRITE_TABLE_ALPHA[NUM_PARTICLE_SIZES] = {";
+    for (int i = 0; i < NUM_PARTICLE_SIZES; i++) out += format("%s ALPHA_%d", i ? "," : "", i);
+    out += " };\nconst SpriteSpan* const SPRITE_TABLE_SPANS[NUM_PARTICLE_SIZES] = {";
+    for (int i = 0; i < NUM_PARTICLE_SIZES; i++) out += format("%s SPANS_%d", i ? "," : "", i);
+    out += " };\n";
+    return out;
+}
+
+static bool readFile(const std::string& path, std::string& out) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+    fclose(f);
+    return true;
+}
+
+static bool writeFile(const std::string& path, const std::string& text) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(text.data(), 1, text.size(), f) == text.size();
+    return fclose(f) == 0 && ok;
+}
+
+int main(int argc, char** argv) {
+    std::string mode = argc == 3 ? argv[1] : "";
+    if (mode != "--write" && mode != "--check") {
+        fprintf(stderr, "usage: %s --write DIR | --check DIR\n", argv[0]);
+        return 2;
+    }
+
+    if (!particleSprites.compute()) {
+        fprintf(stderr, "sprite generation failed\n");
+        return 1;
+    }
+
+    const std::string dir = argv[2];
+    const std::string files[2][2] = {
+        { dir + "/sprite_tables.h", bakeHeader() },
+        { dir + "/sprite_tables.cpp", bakeSource() },
+    };
+
+    int failures = 0;
+    for (const auto& file : files) {
+        if (mode == "--write") {
+            if (!writeFile(file[0], file[1])) {
+                fprintf(stderr, "cannot write %s\n", file[0].c_str());
+                failures++;
+            }
+            continue;
+        }
+
+        std::string current;
+        if (!readFile(file[0], current) || current != file[1]) {
+            printf("%s is stale: run bake_sprites --write %s\n", file[0].c_str(), dir.c_str());
+            failures++;
+        } else {
+            printf("%s ok\n", file[0].c_str());
+        }
+    }
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,116 @@
+/**
+ * Ada Particles bench - incremental base64 decoder test
+ *
+ *   base64_test
+ *
+ * Decodes random payloads with Base64Decoder and compares them with what
+ * was encoded. Each case picks its own arrangement of the input:
+ * - chunk splits, including ones that fall inside a quad;
+ * - whitespace and line breaks between any two characters;
+ * - '=' padding or none;
+ * - an output buffer too small for the payload, which must stop feed()
+ *   early or fail finish(), and then hold a correct prefix.
+ */
+
+#include "../base64_decode.h"
+#include <random>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#define TEST_CASES 2000
+#define TEST_MAX_BYTES 300
+
+static const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static std::string encode(const std::vector<uint8_t>& data, bool pad) {
+    std::string out;
+    for (size_t i = 0; i < data.size(); i += 3) {
+        size_t n = data.size() - i < 3 ? data.size() - i : 3;
+        uint32_t v = data[i] << 16;
+        if (n > 1) v |= data[i + 1] << 8;
+        if (n > 2) v |= data[i + 2];
+        for (size_t k = 0; k < 4; k++) {
+            if (k <= n) out += ALPHABET[(v >> (18 - 6 * k)) & 63];
+            else if (pad) out += '=';
+        }
+    }
+    return out;
+}
+
+int main() {
+    std::mt19937 rng(1234);
+    auto below = [&](size_t n) { return (size_t)(rng() % n); };
+    const char WHITESPACE[] = " \t\r\n";
+    int failures = 0;
+
+    for (int c = 0; c < TEST_CASES; c++) {
+        std::vector<uint8_t> data(below(TEST_MAX_BYTES + 1));
+        for (auto& b : data) b = (uint8_t)rng();
+
+        bool pad = rng() & 1;
+        std::string text;
+        for (char ch : encode(data, pad)) {
+            if (below(8) == 0) text += (below(3) == 0) ? "\r\n" : std::string(1, WHITESPACE[below(4)]);
+            text += ch;
+        }
+        if (rng() & 1) text += '\n';
+
+        // Every other case gets less room than the payload needs
+        bool full = (c & 1) && !data.empty();
+        size_t capacity = full ? below(data.size()) : data.size();
+        std::vector<uint8_t> out(capacity + 8, 0xA5);
+
+        Base64Decoder decoder;
+        decoder.begin(out.data(), capacity);
+        size_t pos = 0;
+        bool stopped = false;
+        while (pos < text.size() && !decoder.isDone()) {
+            size_t len = 1 + below(text.size() - pos < 16 ? text.size() - pos : 16);
+            size_t used = decoder.feed(text.data() + pos, len);
+            pos += used;
+            if (used < len && !decoder.isDone()) {
+                stopped = true;
+                break;
+            }
+        }
+        bool finished = decoder.finish();
+
+        const char* error = nullptr;
+        if (full) {
+            // A full output stops feed() mid-quad, or fails finish()
+            // on the trailing partial quad; either way the output is a
+            // correct prefix, as long as the buffer allows
+            if (!stopped && finished) error = "truncation not reported";
+            else if (decoder.length() > capacity || decoder.length() + 2 < capacity) error = "wrong length";
+            else if (memcmp(out.data(), data.data(), decoder.length()) != 0) error = "wrong prefix";
+        } else if (!finished) {
+            error = "finish() failed";
+        } else if (decoder.length() != data.size()) {
+            error = "wrong length";
+        } else if (memcmp(out.data(), data.data(), data.size()) != 0) {
+            error = "wrong bytes";
+        }
+        for (size_t i = capacity; i < out.size() && !error; i++) {
+            if (out[i] != 0xA5) error = "wrote past the capacity";
+        }
+
+        if (error) {
+            printf("case %d (%zu bytes, capacity %zu, %s): %s\n", c, data.size(), capacity,
+                   pad ? "padded" : "unpadded", error);
+            failures++;
+        }
+    }
+
+    // The one-shot wrapper on a padded payload with a line break
+    uint8_t out[8];
+    size_t outLen = 0;
+    if (!base64_decode("YWJj\nZA==", out, &outLen) || outLen != 4 || memcmp(out, "abcd", 4) != 0) {
+        printf("base64_decode: wrong result\n");
+        failures++;
+    }
+
+    printf("%d cases, %d failures\n", TEST_CASES + 1, failures);
+    return failures ? 1 : 0;
+}
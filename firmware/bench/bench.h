@@ -0,0 +1,61 @@
+/**
+ * Ada Particles bench - scenes
+ *
+ * Each scene runs the firmware kernels from a fixed seed on the
+ * simulated clock and reports its timings and a checksum of its
+ * output: the panel contents for render scenes, the kernel results
+ * for math scenes.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <Arduino.h>
+#include <chrono>
+
+#define BENCH_SEED 1234
+#define BENCH_FRAMES 150
+#define BENCH_FRAME_US (1000000 / TARGET_FPS)
+
+struct SceneResult {
+    uint64_t checksum;
+    uint32_t iterations;    // Frames, or kernel calls
+    double updateNs;        // Per iteration
+    double renderNs;        // Per frame (render scenes only)
+    uint64_t bytesPushed;   // Per frame
+    int particles;          // Live at the end
+};
+
+// Native engine (src/)
+void scene_idle(SceneResult& out);
+void scene_heart(SceneResult& out);
+
+// Native engine driven by a recorded server session (--log)
+void scene_replay(SceneResult& out);
+extern const char* bench_log_path;
+
+// Image engine (particle_system.h)
+void scene_image(SceneResult& out);
+
+// Math kernels
+void scene_noise(SceneResult& out);
+void scene_fixed(SceneResult& out);
+
+// Print the profiler's per-stage stats (ns per frame)
+void bench_print_stages();
+
+static inline uint64_t bench_fnv1a(const void* data, size_t len, uint64_t hash = 1469598103934665603ULL) {
+    const uint8_t* p = (const uint8_t*)data;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= p[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static inline uint64_t bench_now_ns() {
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+#endif // BENCH_H
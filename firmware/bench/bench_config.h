@@ -0,0 +1,52 @@
+/**
+ * Ada Particles bench - build configuration
+ *
+ * Force-included ahead of every source file. It pulls in the firmware
+ * config.h first; config.h's include guard then makes the overrides
+ * below stick, so one bench build per kernel variant can be checked
+ * against the same goldens.
+ */
+
+#ifndef BENCH_CONFIG_H
+#define BENCH_CONFIG_H
+
+#include "../config.h"
+
+#ifdef BENCH_SCALAR_FADE
+#undef FADE_KERNEL_SWAR
+#endif
+
+#ifdef BENCH_UNTILED
+#undef FB_TILED_RENDER
+#endif
+
+#ifdef BENCH_SYNC_PUSH
+#undef FRAMEBUFFER_ASYNC_PUSH
+#endif
+
+#ifdef BENCH_INTENSITY
+#define FB_INTENSITY_RENDER
+#endif
+
+#ifdef BENCH_HALF_SCALE
+#undef FB_RENDER_SHIFT
+#define FB_RENDER_SHIFT 1
+#endif
+
+// The replay scene plays recorded sessions through the message log
+#define MESSAGE_LOG
+
+// Image engine (particle_system.h) tuning that config.h does not
+// carry; same defaults as the server's reference renderer
+// (server/particle_renderer.py)
+#define DEFAULT_PARTICLE_SIZE 4.0f
+#define DEFAULT_PARTICLE_SPEED 1.0f
+#define DEFAULT_DISPERSION 30.0f
+#define DEFAULT_OPACITY 1.0f
+#define DEFAULT_PULSE_SPEED 1.0f
+#define DEFAULT_ROTATION_SPEED 0.0f
+#define FADE_OUT_SPEED 2.0f
+#define POSITION_LERP_SPEED 2.0f
+#define CONFIG_LERP_SPEED 3.0f
+
+#endif // BENCH_CONFIG_H
@@ -0,0 +1,102 @@
+/**
+ * Ada Particles bench - image engine scene
+ *
+ * The image engine (particle_system.h) and the native engine
+ * (src/particle_system.h) both define a ParticleSystem class. The image
+ * engine is header-only, so it is compiled here inside its own
+ * namespace: its dependencies are included first, at global scope,
+ * and their include guards keep them there.
+ */
+
+#include "bench.h"
+#include "../config.h"
+#include "../image_frame.h"
+#include "../src/fixed_math.h"
+#include "../src/framebuffer.h"
+#include "../src/memory_arena.h"
+#include "../src/morton.h"
+#include "../src/profiler.h"
+#include "../src/spatial_grid.h"
+#include "../src/sprites.h"
+#include <ArduinoJson.h>
+
+namespace image_engine {
+#include "../particle_system.h"
+}
+
+static Arduino_GFX gfx;
+static Framebuffer framebuffer;
+static image_engine::ParticleSystem engine;
+
+#define IMAGE_SIZE 96
+
+/**
+ * A lit disc with a hue sweep and a dark ring of radius ring cut out
+ * of it.
+ */
+static void makeImage(uint8_t* rgb, int ring) {
+    const int c = IMAGE_SIZE / 2;
+    for (int y = 0; y < IMAGE_SIZE; y++) {
+        for (int x = 0; x < IMAGE_SIZE; x++) {
+            int d2 = (x - c) * (x - c) + (y - c) * (y - c);
+            bool lit = d2 < c * c && (d2 < (ring - 4) * (ring - 4) || d2 > (ring + 4) * (ring + 4));
+            uint8_t* p = &rgb[(y * IMAGE_SIZE + x) * 3];
+            p[0] = lit ? (uint8_t)(x * 255 / IMAGE_SIZE) : 0;
+            p[1] = lit ? (uint8_t)(y * 255 / IMAGE_SIZE) : 0;
+            p[2] = lit ? 160 : 0;
+        }
+    }
+}
+
+void scene_image(SceneResult& out) {
+    // Ask for 800 particles (the engine caps them at MAX_PARTICLES)
+    // with links, cycling through the animations, then morph to an
+    // image with a smaller ring halfway through
+    static uint8_t rgb[IMAGE_SIZE * IMAGE_SIZE * 3];
+    randomSeed(BENCH_SEED);
+    framebuffer.init(&gfx);
+#ifdef FB_INTENSITY_RENDER
+    // The engine draws levels only; show them in the disc's blue
+    framebuffer.setTint(0x041F);
+#endif
+    engine.init();
+
+    image_engine::ParticleConfig config = engine.getConfig();
+    config.particle_count = 800;
+    config.link_count = 40;
+    config.link_opacity = 0.3f;
+    engine.updateConfig(config);
+
+    uint64_t updateNs = 0, renderNs = 0;
+    for (int f = 0; f < BENCH_FRAMES; f++) {
+        if (f == 0 || f == BENCH_FRAMES / 2) {
+            makeImage(rgb, f ? 12 : 24);
+            uint64_t t0 = bench_now_ns();
+            engine.createFromImage(rgb, IMAGE_SIZE, IMAGE_SIZE);
+            printf("    %-10s %9llu ns\n", f ? "morph" : "ingest", (unsigned long long)(bench_now_ns() - t0));
+        }
+        if (f % 50 == 49) {
+            config.animation = (config.animation + 1) % 4;
+            engine.updateConfig(config);
+        }
+
+        uint64_t t0 = bench_now_ns();
+        engine.update(BENCH_FRAME_US / 1000000.0f);
+        uint64_t t1 = bench_now_ns();
+        engine.render(framebuffer);
+        uint64_t t2 = bench_now_ns();
+        PROFILE_COMMIT(PROFILE_RENDER_FIRST, PROFILE_RENDER_LAST);
+
+        updateNs += t1 - t0;
+        renderNs += t2 - t1;
+        bench_advance_us(BENCH_FRAME_US);
+    }
+    framebuffer.waitForPush();
+
+    out.checksum = bench_fnv1a(gfx.panel, sizeof(gfx.panel));
+    out.iterations = BENCH_FRAMES;
+    out.updateNs = (double)updateNs / BENCH_FRAMES;
+    out.renderNs = (double)renderNs / BENCH_FRAMES;
+    out.bytesPushed = gfx.bytesPushed / BENCH_FRAMES;
+    out.particles = engine.getActiveCount();
+}
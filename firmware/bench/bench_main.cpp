@@ -0,0 +1,186 @@
+/**
+ * Ada Particles bench - host benchmark and golden checksum runner
+ *
+ *   ada_bench [--check FILE | --write FILE] [--log FILE] [scene...]
+ *
+ * Runs the named scenes (all by default) and prints per-frame timings.
+ * Every scene runs in its own process, so each one starts from a fresh
+ * engine, clock and random seed. With --check, each scene's checksum must
+ * match FILE. --write regenerates FILE after an intended output change.
+ * A render scene that leaves the panel blank always fails: its
+ * checksum would check nothing.
+ * --log picks the session the replay scene plays (a message log dump;
+ * the golden is for the default, logs/sample.txt).
+ */
+
+#include "bench.h"
+#include <map>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+struct Scene {
+    const char* name;
+    void (*run)(SceneResult& out);
+    bool frames;    // Render scene (else a math kernel)
+};
+
+static const Scene SCENES[] = {
+    { "idle",   scene_idle,   true },
+    { "heart",  scene_heart,  true },
+    { "replay", scene_replay, true },
+    { "image",  scene_image,  true },
+    { "noise",  scene_noise,  false },
+    { "fixed",  scene_fixed,  false },
+};
+
+static const int SCENE_COUNT = sizeof(SCENES) / sizeof(SCENES[0]);
+
+const char* bench_log_path = BENCH_DEFAULT_LOG;
+
+/**
+ * Run one scene in a child process and return its checksum.
+ * @return false if the scene crashed
+ */
+static bool runScene(const Scene& scene, uint64_t& checksum) {
+    int fds[2];
+    if (pipe(fds) != 0) return false;
+    fflush(stdout);
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        SceneResult r = {};
+        printf("%s\n", scene.name);
+        scene.run(r);
+        if (scene.frames) {
+            printf("    %-10s %9.0f ns/frame\n", "update", r.updateNs);
+            printf("    %-10s %9.0f ns/frame\n", "render", r.renderNs);
+            bench_print_stages();
+            printf("    %d particles, %llu bytes pushed per frame\n", r.particles,
+                   (unsigned long long)r.bytesPushed);
+        } else {
+            printf("    %-10s %9.1f ns/call (%u calls)\n", "kernel", r.updateNs, (unsigned)r.iterations);
+        }
+        fflush(stdout);
+        ssize_t written = write(fds[1], &r.checksum, sizeof(r.checksum));
+        _exit(written == sizeof(r.checksum) ? 0 : 1);
+    }
+
+    close(fds[1]);
+    ssize_t got = (pid > 0) ? read(fds[0], &checksum, sizeof(checksum)) : -1;
+    close(fds[0]);
+
+    int status = 0;
+    if (pid > 0) waitpid(pid, &status, 0);
+    return got == sizeof(checksum) && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+/**
+ * Checksum of an all-black panel (what a scene that draws nothing ends on).
+ */
+static uint64_t blankPanelChecksum() {
+    static const uint16_t blank[SCREEN_WIDTH * SCREEN_HEIGHT] = {};
+    return bench_fnv1a(blank, sizeof(blank));
+}
+
+static bool loadGoldens(const char* path, std::map<std::string, uint64_t>& goldens) {
+    FILE* f = fopen(path, "r");
+    if (!f) return false;
+
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        char name[64];
+        unsigned long long value;
+        if (line[0] == '#') continue;
+        if (sscanf(line, "%63s %llx", name, &value) == 2) {
+            goldens[name] = value;
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    const char* checkPath = nullptr;
+    const char* writePath = nullptr;
+    bool selected[SCENE_COUNT] = {};
+    bool any = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--check" && i + 1 < argc) {
+            checkPath = argv[++i];
+        } else if (arg == "--write" && i + 1 < argc) {
+            writePath = argv[++i];
+        } else if (arg == "--log" && i + 1 < argc) {
+            bench_log_path = argv[++i];
+        } else {
+            int s = 0;
+            while (s < SCENE_COUNT && arg != SCENES[s].name) s++;
+            if (s == SCENE_COUNT) {
+                fprintf(stderr, "usage: %s [--check FILE | --write FILE] [--log FILE] [scene...]\nscenes:", argv[0]);
+                for (int k = 0; k < SCENE_COUNT; k++) fprintf(stderr, " %s", SCENES[k].name);
+                fprintf(stderr, "\n");
+                return 2;
+            }
+            selected[s] = any = true;
+        }
+    }
+
+    std::map<std::string, uint64_t> goldens;
+    if (checkPath && !loadGoldens(checkPath, goldens)) {
+        fprintf(stderr, "cannot read %s\n", checkPath);
+        return 2;
+    }
+
+    std::string written;
+    int failures = 0;
+    for (int s = 0; s < SCENE_COUNT; s++) {
+        if (any && !selected[s]) continue;
+
+        uint64_t checksum = 0;
+        if (!runScene(SCENES[s], checksum)) {
+            printf("    FAILED (scene did not finish)\n");
+            failures++;
+            continue;
+        }
+        printf("    checksum %016llx", (unsigned long long)checksum);
+
+        if (SCENES[s].frames && checksum == blankPanelChecksum()) {
+            printf("  BLANK panel\n");
+            failures++;
+            continue;
+        }
+
+        if (checkPath) {
+            auto golden = goldens.find(SCENES[s].name);
+            if (golden == goldens.end()) {
+                printf("  MISSING from goldens");
+                failures++;
+            } else if (golden->second != checksum) {
+                printf("  MISMATCH (golden %016llx)", (unsigned long long)golden->second);
+                failures++;
+            } else {
+                printf("  ok");
+            }
+        }
+        printf("\n");
+
+        char line[96];
+        snprintf(line, sizeof(line), "%s %016llx\n", SCENES[s].name, (unsigned long long)checksum);
+        written += line;
+    }
+
+    if (writePath) {
+        FILE* f = fopen(writePath, "w");
+        if (!f) {
+            fprintf(stderr, "cannot write %s\n", writePath);
+            return 2;
+        }
+        fprintf(f, "# scene checksum (ada_bench --write)\n%s", written.c_str());
+        fclose(f);
+    }
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,174 @@
+/**
+ * Ada Particles bench - native engine and math kernel scenes
+ */
+
+#include "bench.h"
+#include "../src/particle_system.h"
+#include "../src/profiler.h"
+#include "../src/noise.h"
+#include "../src/server_messages.h"
+#include "../src/message_log.h"
+#include <fstream>
+
+static Arduino_GFX gfx;
+
+/**
+ * Run the native engine for BENCH_FRAMES frames; script(frame) may
+ * change its state before each one.
+ */
+template <class Script>
+static void runNative(SceneResult& out, Script script) {
+    randomSeed(BENCH_SEED);
+    particleSystem.init(&gfx);
+
+    uint64_t updateNs = 0, renderNs = 0;
+    for (int f = 0; f < BENCH_FRAMES; f++) {
+        script(f);
+
+        uint64_t t0 = bench_now_ns();
+        particleSystem.update(BENCH_FRAME_US / 1000000.0f);
+        uint64_t t1 = bench_now_ns();
+        particleSystem.render();
+        uint64_t t2 = bench_now_ns();
+        PROFILE_COMMIT(PROFILE_RENDER_FIRST, PROFILE_RENDER_LAST);
+
+        updateNs += t1 - t0;
+        renderNs += t2 - t1;
+        bench_advance_us(BENCH_FRAME_US);
+    }
+    particleSystem.waitForDisplay();
+
+    out.checksum = bench_fnv1a(gfx.panel, sizeof(gfx.panel));
+    out.iterations = BENCH_FRAMES;
+    out.updateNs = (double)updateNs / BENCH_FRAMES;
+    out.renderNs = (double)renderNs / BENCH_FRAMES;
+    out.bytesPushed = gfx.bytesPushed / BENCH_FRAMES;
+    out.particles = particleSystem.getActiveParticles();
+}
+
+void scene_idle(SceneResult& out) {
+    // Default state: DEFAULT_PARTICLE_COUNT particles wandering
+    runNative(out, [](int) {});
+}
+
+void scene_heart(SceneResult& out) {
+    // Form a heart, shift the mood mid-way, then scatter with a touch
+    runNative(out, [](int f) {
+        if (f == 0) particleSystem.setFormation(FORMATION_HEART, 1000);
+        if (f == 75) particleSystem.setMood(0.8f, 0.9f);
+        if (f == 110) particleSystem.onTouch(SCREEN_CENTER_X, SCREEN_CENTER_Y - 40);
+    });
+}
+
+static MessageLog sessionLog;
+static MessageReplay sessionReplay;
+
+// The firmware's handleCommand(), less the display backlight
+static void applyCommand(const Command& cmd) {
+    switch (cmd.type) {
+        case CMD_SET_MOOD:
+            particleSystem.setMood(cmd.mood.valence, cmd.mood.arousal);
+            break;
+        case CMD_SET_FORMATION:
+            particleSystem.setFormation((FormationType)cmd.formation.type, cmd.formation.transitionMs);
+            break;
+        case CMD_SET_PARTICLE_COUNT:
+            particleSystem.setParticleCount(cmd.particleCount);
+            break;
+        case CMD_SET_DISCONNECTED:
+            particleSystem.setDisconnected(cmd.disconnected);
+            break;
+        case CMD_SET_BRIGHTNESS:
+            break;
+    }
+}
+
+static void deliverMessage(const LoggedMessage& msg) {
+    parseServerMessage(msg.data, msg.len, msg.binary, applyCommand);
+}
+
+static bool loadSession(const char* path) {
+    std::ifstream in(path);
+    if (!in || !sessionLog.init()) return false;
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        lineNumber++;
+        if (!sessionLog.loadLine(line.c_str())) {
+            fprintf(stderr, "%s:%d: bad message log line\n", path, lineNumber);
+            return false;
+        }
+    }
+    return true;
+}
+
+void scene_replay(SceneResult& out) {
+    // A dumped server session (MESSAGE_LOG), delivered at its recorded
+    // times through the firmware's message handler
+    if (!loadSession(bench_log_path)) {
+        fprintf(stderr, "cannot load message log %s\n", bench_log_path);
+        exit(1);
+    }
+
+    runNative(out, [](int f) {
+        if (f == 0) sessionReplay.start(sessionLog, millis());
+        sessionReplay.poll(millis(), deliverMessage);
+    });
+}
+
+void scene_noise(SceneResult& out) {
+    // Curl noise over a 64x64 grid of screen positions, 8 time slices
+    const float scale = NOISE_SCALE * 65536;
+    noise_init(BENCH_SEED);
+
+    uint64_t hash = bench_fnv1a(nullptr, 0);
+    uint32_t calls = 0;
+    uint64_t t0 = bench_now_ns();
+    for (uint32_t t = 0; t < 8; t++) {
+        for (uint32_t gy = 0; gy < 64; gy++) {
+            for (uint32_t gx = 0; gx < 64; gx++) {
+                uint32_t x = (uint32_t)((gx * SCREEN_WIDTH / 64) * scale);
+                uint32_t y = (uint32_t)((gy * SCREEN_HEIGHT / 64) * scale);
+                fixed_t v[2];
+                curl_noise_2d(x, y, t * FLOAT_TO_FIXED(0.25f), &v[0], &v[1]);
+                hash = bench_fnv1a(v, sizeof(v), hash);
+                calls++;
+            }
+        }
+    }
+    uint64_t t1 = bench_now_ns();
+
+    out.checksum = hash;
+    out.iterations = calls;
+    out.updateNs = (double)(t1 - t0) / calls;
+}
+
+void scene_fixed(SceneResult& out) {
+    // sqrt, div and sin across their useful input ranges
+    uint64_t hash = bench_fnv1a(nullptr, 0);
+    const uint32_t calls = 65536;
+    uint64_t t0 = bench_now_ns();
+    for (uint32_t i = 0; i < calls; i++) {
+        fixed_t a = (fixed_t)(i * 4099u) & 0x3FFFFFF;     // 0 to 1024
+        fixed_t b = (fixed_t)(i * 40503u % 0x1FFFFF) + FIXED_ONE / 16;
+        fixed_t v[3] = { fixed_sqrt(a), fixed_div(a, b), fixed_sin((fixed_t)(i * 977u)) };
+        hash = bench_fnv1a(v, sizeof(v), hash);
+    }
+    uint64_t t1 = bench_now_ns();
+
+    out.checksum = hash;
+    out.iterations = calls;
+    out.updateNs = (double)(t1 - t0) / calls;
+}
+
+void bench_print_stages() {
+#ifdef DEBUG_ENABLED
+    for (uint8_t s = PROFILE_RENDER_FIRST; s <= PROFILE_RENDER_LAST; s++) {
+        ProfileStats stats;
+        if (!profiler.getStats(s, stats)) continue;
+        printf("    %-10s avg %9u  p99 %9u  max %9u ns\n", Profiler::stageName(s),
+               (unsigned)stats.avgUs, (unsigned)stats.p99Us, (unsigned)stats.maxUs);
+    }
+#endif
+}
@@ -0,0 +1,82 @@
+/**
+ * Ada Particles bench - Arduino core shim
+ *
+ * Just enough of the Arduino/ESP32 API for the firmware sources to
+ * build on a desktop:
+ * - Time (millis/micros) is a simulated clock that the bench advances
+ *   one frame at a time, so time-dependent code runs the same on
+ *   every host.
+ * - random() is a fixed-seed generator.
+ * - Serial is silent.
+ * - PSRAM allocations use the host heap.
+ */
+
+#ifndef BENCH_ARDUINO_H
+#define BENCH_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+using std::min;
+using std::max;
+
+#define PROGMEM
+#define PI 3.1415926535897932384626433832795f
+#define TWO_PI 6.283185307179586476925286766559f
+#define DEG_TO_RAD 0.017453292519943295769236907684886f
+
+template <class T, class L, class H>
+inline T constrain(T x, L lo, H hi) { return x < lo ? (T)lo : (x > hi ? (T)hi : x); }
+
+// Simulated clock, advanced by bench_advance_us()
+unsigned long millis();
+unsigned long micros();
+void bench_advance_us(uint32_t us);
+inline void delay(unsigned long) {}
+inline void yield() {}
+
+// Deterministic random numbers (reseed with randomSeed)
+uint32_t bench_random();
+void randomSeed(uint32_t seed);
+inline long random(long hi) { return hi > 0 ? (long)(bench_random() % (uint32_t)hi) : 0; }
+inline long random(long lo, long hi) { return hi > lo ? lo + random(hi - lo) : lo; }
+inline uint32_t esp_random() { return bench_random(); }
+
+inline void* ps_malloc(size_t size) { return malloc(size); }
+
+class String : public std::string {
+public:
+    using std::string::string;
+    String() {}
+    String(const std::string& s) : std::string(s) {}
+    bool startsWith(const char* prefix) const { return rfind(prefix, 0) == 0; }
+};
+
+struct BenchSerial {
+    template <class... A> void printf(const char*, A...) {}
+    template <class T> void print(T) {}
+    template <class T> void println(T) {}
+    void println() {}
+    size_t write(const uint8_t*, size_t len) { return len; }
+    void begin(unsigned long) {}
+    explicit operator bool() const { return true; }
+};
+extern BenchSerial Serial;
+
+// The cycle counter counts host nanoseconds, and the CPU reports 1 MHz,
+// so profiler stats (cycles / MHz) come out in nanoseconds
+struct BenchEsp {
+    uint32_t getCycleCount();
+    uint32_t getCpuFreqMHz() { return 1; }
+    uint32_t getFreePsram() { return 0; }
+    uint32_t getFreeHeap() { return 0; }
+};
+extern BenchEsp ESP;
+
+#endif // BENCH_ARDUINO_H
@@ -0,0 +1,94 @@
+/**
+ * Ada Particles bench - ArduinoJson shim
+ *
+ * The slice of the ArduinoJson 6 API the firmware reads with:
+ * deserializeJson() into a document, then operator[], containsKey()
+ * and "value | default". It parses full JSON, but keeps only numbers,
+ * strings and objects (arrays, booleans and null read as missing), and
+ * ignores the document's capacity.
+ *
+ * JsonObject is the image engine's parseConfig() parameter; the bench
+ * never calls it, so it is always empty.
+ */
+
+#ifndef BENCH_ARDUINO_JSON_H
+#define BENCH_ARDUINO_JSON_H
+
+#include <Arduino.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+struct JsonNode {
+    enum Kind : uint8_t { MISSING, NUMBER, STRING, OBJECT } kind = MISSING;
+    double number = 0;
+    std::string text;
+    std::vector<std::pair<std::string, JsonNode>> members;
+
+    const JsonNode* find(const char* key) const {
+        for (const auto& m : members) {
+            if (m.first == key) return &m.second;
+        }
+        return nullptr;
+    }
+};
+
+class JsonVariantConst {
+public:
+    JsonVariantConst(const JsonNode* node = nullptr) : _node(node) {}
+
+    JsonVariantConst operator[](const char* key) const {
+        return JsonVariantConst(isObject() ? _node->find(key) : nullptr);
+    }
+    bool containsKey(const char* key) const { return isObject() && _node->find(key); }
+
+    template <class T> T as() const {
+        if constexpr (std::is_arithmetic<T>::value) {
+            if (isNumber()) return (T)_node->number;
+        }
+        return T();
+    }
+
+    float operator|(float def) const { return isNumber() ? (float)_node->number : def; }
+    int operator|(int def) const { return isNumber() ? (int)_node->number : def; }
+    const char* operator|(const char* def) const {
+        return (_node && _node->kind == JsonNode::STRING) ? _node->text.c_str() : def;
+    }
+
+private:
+    const JsonNode* _node;
+
+    bool isObject() const { return _node && _node->kind == JsonNode::OBJECT; }
+    bool isNumber() const { return _node && _node->kind == JsonNode::NUMBER; }
+};
+
+class JsonDocument {
+public:
+    JsonVariantConst operator[](const char* key) const { return JsonVariantConst(&root)[key]; }
+    bool containsKey(const char* key) const { return JsonVariantConst(&root).containsKey(key); }
+
+    JsonNode root;
+};
+
+template <size_t CAPACITY>
+class StaticJsonDocument : public JsonDocument {};
+
+class DeserializationError {
+public:
+    explicit DeserializationError(const char* message = nullptr) : _message(message) {}
+    explicit operator bool() const { return _message != nullptr; }
+    const char* c_str() const { return _message ? _message : "Ok"; }
+
+private:
+    const char* _message;
+};
+
+DeserializationError deserializeJson(JsonDocument& doc, const char* input, size_t inputSize);
+
+struct JsonObject {
+    bool containsKey(const char*) const { return false; }
+    JsonVariantConst operator[](const char*) const { return JsonVariantConst(); }
+};
+
+#endif // BENCH_ARDUINO_JSON_H
@@ -0,0 +1,30 @@
+/**
+ * Ada Particles bench - Arduino_GFX shim
+ *
+ * A display that keeps what is pushed to it in a screen-sized RGB565
+ * buffer (for golden checksums) and counts the bytes it was sent.
+ */
+
+#ifndef BENCH_ARDUINO_GFX_H
+#define BENCH_ARDUINO_GFX_H
+
+#include <Arduino.h>
+#include "../../config.h"
+
+class Arduino_GFX {
+public:
+    Arduino_GFX() : bytesPushed(0) { memset(panel, 0, sizeof(panel)); }
+    virtual ~Arduino_GFX() {}
+    
+    void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) {
+        for (int16_t row = 0; row < h; row++) {
+            memcpy(&panel[(y + row) * SCREEN_WIDTH + x], &bitmap[row * w], w * sizeof(uint16_t));
+        }
+        bytesPushed += (uint32_t)w * h * sizeof(uint16_t);
+    }
+    
+    uint16_t panel[SCREEN_WIDTH * SCREEN_HEIGHT];
+    uint64_t bytesPushed;
+};
+
+#endif // BENCH_ARDUINO_GFX_H
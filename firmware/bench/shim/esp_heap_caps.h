@@ -0,0 +1,22 @@
+/**
+ * Ada Particles bench - ESP-IDF heap shim (every region is the host heap)
+ */
+
+#ifndef BENCH_ESP_HEAP_CAPS_H
+#define BENCH_ESP_HEAP_CAPS_H
+
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+inline void* heap_caps_malloc(size_t size, unsigned) { return malloc(size); }
+inline void* heap_caps_aligned_alloc(size_t alignment, size_t size, unsigned) {
+    return aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+inline void heap_caps_free(void* p) { free(p); }
+inline size_t heap_caps_get_free_size(unsigned) { return 0; }
+
+#endif // BENCH_ESP_HEAP_CAPS_H
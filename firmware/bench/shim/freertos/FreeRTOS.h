@@ -0,0 +1,29 @@
+/**
+ * Ada Particles bench - FreeRTOS shim on std::thread
+ */
+
+#ifndef BENCH_FREERTOS_H
+#define BENCH_FREERTOS_H
+
+#include <stdint.h>
+#include <condition_variable>
+#include <mutex>
+
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS pdTRUE
+#define portMAX_DELAY 0xFFFFFFFFu
+#define configTICK_RATE_HZ 1000
+
+// Counting semaphore (binary: at most one token)
+struct BenchSemaphore {
+    std::mutex lock;
+    std::condition_variable ready;
+    unsigned tokens = 0;
+};
+
+#endif // BENCH_FREERTOS_H
@@ -0,0 +1,29 @@
+#ifndef BENCH_SEMPHR_H
+#define BENCH_SEMPHR_H
+
+#include "FreeRTOS.h"
+
+typedef BenchSemaphore* SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return new BenchSemaphore; }
+
+// Kept alive: a task blocked on it cannot be stopped on the host
+inline void vSemaphoreDelete(SemaphoreHandle_t) {}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+    std::lock_guard<std::mutex> guard(s->lock);
+    if (s->tokens) return pdFALSE;
+    s->tokens = 1;
+    s->ready.notify_one();
+    return pdTRUE;
+}
+
+// Only portMAX_DELAY waits are used by the firmware
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t) {
+    std::unique_lock<std::mutex> guard(s->lock);
+    s->ready.wait(guard, [s] { return s->tokens > 0; });
+    s->tokens = 0;
+    return pdTRUE;
+}
+
+#endif // BENCH_SEMPHR_H
@@ -0,0 +1,21 @@
+#ifndef BENCH_TASK_H
+#define BENCH_TASK_H
+
+#include "FreeRTOS.h"
+#include <thread>
+
+typedef void (*TaskFunction_t)(void*);
+typedef std::thread* TaskHandle_t;
+
+// Tasks run on detached host threads until the process exits
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char*, uint32_t, void* arg,
+                                          UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+    std::thread* t = new std::thread(fn, arg);
+    t->detach();
+    if (handle) *handle = t;
+    return pdPASS;
+}
+
+inline void vTaskDelete(TaskHandle_t) {}
+
+#endif // BENCH_TASK_H
@@ -0,0 +1,141 @@
+/**
+ * Ada Particles bench - shim globals and JSON parser
+ */
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <chrono>
+
+BenchSerial Serial;
+BenchEsp ESP;
+
+static uint64_t simulatedUs = 0;
+static uint32_t randomState = 1;
+
+unsigned long millis() { return (unsigned long)(simulatedUs / 1000); }
+unsigned long micros() { return (unsigned long)simulatedUs; }
+void bench_advance_us(uint32_t us) { simulatedUs += us; }
+
+// xorshift32: the same sequence on every host and C library
+uint32_t bench_random() {
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+void randomSeed(uint32_t seed) { randomState = seed ? seed : 1; }
+
+uint32_t BenchEsp::getCycleCount() {
+    using namespace std::chrono;
+    return (uint32_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// ============================================
+// JSON
+// ============================================
+
+struct JsonParser {
+    const char* p;
+    const char* end;
+
+    void skipSpace() {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) p++;
+    }
+
+    bool literal(const char* word) {
+        size_t n = strlen(word);
+        if ((size_t)(end - p) < n || memcmp(p, word, n) != 0) return false;
+        p += n;
+        return true;
+    }
+
+    bool string(std::string& out) {
+        if (p >= end || *p != '"') return false;
+        p++;
+        while (p < end && *p != '"') {
+            char c = *p++;
+            if (c == '\\') {
+                if (p >= end) return false;
+                c = *p++;
+                switch (c) {
+                    case 'n': c = '\n'; break;
+                    case 't': c = '\t'; break;
+                    case 'r': c = '\r'; break;
+                    case 'b': c = '\b'; break;
+                    case 'f': c = '\f'; break;
+                    case 'u':
+                        // Only ASCII escapes are needed here
+                        if (end - p < 4) return false;
+                        c = (char)strtol(std::string(p, 4).c_str(), nullptr, 16);
+                        p += 4;
+                        break;
+                }
+            }
+            out += c;
+        }
+        if (p >= end) return false;
+        p++;
+        return true;
+    }
+
+    bool value(JsonNode& node, int depth) {
+        skipSpace();
+        if (p >= end || depth > 16) return false;
+
+        if (*p == '{' || *p == '[') {
+            bool object = *p == '{';
+            char close = object ? '}' : ']';
+            node.kind = object ? JsonNode::OBJECT : JsonNode::MISSING;
+            p++;
+            skipSpace();
+            if (p < end && *p == close) {
+                p++;
+                return true;
+            }
+            for (;;) {
+                std::string key;
+                if (object) {
+                    skipSpace();
+                    if (!string(key)) return false;
+                    skipSpace();
+                    if (p >= end || *p++ != ':') return false;
+                }
+                JsonNode child;
+                if (!value(child, depth + 1)) return false;
+                if (object) node.members.emplace_back(key, std::move(child));
+                skipSpace();
+                if (p < end && *p == ',') {
+                    p++;
+                    continue;
+                }
+                if (p < end && *p == close) {
+                    p++;
+                    return true;
+                }
+                return false;
+            }
+        }
+        if (*p == '"') {
+            node.kind = JsonNode::STRING;
+            return string(node.text);
+        }
+        if (literal("true") || literal("false") || literal("null")) return true;
+
+        std::string number;
+        while (p < end && *p && strchr("+-.0123456789eE", *p)) number += *p++;
+        if (number.empty()) return false;
+        node.kind = JsonNode::NUMBER;
+        node.number = strtod(number.c_str(), nullptr);
+        return true;
+    }
+};
+
+DeserializationError deserializeJson(JsonDocument& doc, const char* input, size_t inputSize) {
+    doc.root = JsonNode();
+    JsonParser parser = { input, input + inputSize };
+    if (!parser.value(doc.root, 0)) return DeserializationError("InvalidInput");
+    parser.skipSpace();
+    if (parser.p != parser.end) return DeserializationError("InvalidInput");
+    return DeserializationError();
+}
@@ -30,6 +30,10 @@
 #define SCREEN_CENTER_X (SCREEN_WIDTH / 2)
 #define SCREEN_CENTER_Y (SCREEN_HEIGHT / 2)
 
+// Panel is a circle inscribed in the framebuffer: tiles outside it
+// are never faded or pushed. Comment out for rectangular panels.
+#define DISPLAY_ROUND
+
 // Display rotation: 0=0°, 1=90°CW, 2=180°, 3=270°CW
 // USB-C on left (default) = 0
 // USB-C on bottom = 3 (270° CW rotation)
@@ -73,6 +77,17 @@
 #define PARTICLE_SIZE_LARGE   24
 #define NUM_PARTICLE_SIZES    3
 
+// Sub-pixel sprite phases: 2^SHIFT offsets per axis (2 = quarter
+// pixels, 0 = snap to whole pixels). Each size is pre-rendered at
+// every phase on a (diameter + 1) grid, ~16 KB of PSRAM at 2.
+#define SPRITE_SUBPIXEL_SHIFT 2
+#define SPRITE_SUBPIXEL_STEPS (1 << SPRITE_SUBPIXEL_SHIFT)
+#define SPRITE_PHASES (SPRITE_SUBPIXEL_STEPS * SPRITE_SUBPIXEL_STEPS)
+#define SPRITE_GRID(d) ((d) + (SPRITE_SUBPIXEL_SHIFT > 0 ? 1 : 0))
+
+// Diameter a sprite is rendered at in the framebuffer (render scale)
+#define SPRITE_DIAMETER(d) ((d) >> FB_RENDER_SHIFT)
+
 // ============================================
 // Physics Tuning
 // ============================================
@@ -92,6 +107,19 @@
 // Maximum velocity (prevents particles flying off)
 #define MAX_VELOCITY 8.0f
 
+// Fixed physics step: the simulation advances in steps of 1/PHYSICS_HZ
+// seconds whatever the frame rate, running up to PHYSICS_MAX_STEPS per
+// rendered frame (any further backlog is dropped), and particles are
+// drawn interpolated between the last two steps. Velocities and
+// damping are tuned per 1/30 s step; a lower rate trades motion
+// smoothness for CPU when rendering is the bottleneck.
+#define PHYSICS_HZ 30
+#define PHYSICS_MAX_STEPS 4
+
+// Spatial grid cell size for neighbor queries (touch, links):
+// 2^6 = 64 pixel cells, 8x8 over the screen
+#define SPATIAL_GRID_CELL_SHIFT 6
+
 // ============================================
 // Rendering Configuration
 // ============================================
@@ -100,10 +128,38 @@
 // 0.92 means each frame retains 92% of previous brightness
 #define FADE_FACTOR 0.92f
 
+// Fade kernel: two RGB565 pixels per 32-bit word (same output as the
+// per-pixel loop). Comment out to use the scalar kernel.
+#define FADE_KERNEL_SWAR
+
+// Intensity rendering: the framebuffer holds one 8-bit intensity per
+// pixel instead of RGB565 (half the PSRAM), fades and blends are byte
+// operations, and frames are colorized with the mood color through a
+// 256-entry LUT while being pushed. Everything on screen shares that
+// one color, so this suits the single-color src/ engine only.
+// Uncomment to enable.
+// #define FB_INTENSITY_RENDER
+
+// Tint (RGB565) intensity frames are shown in until setTint() is
+// called. Engines that never set one, like the image engine, draw in
+// this color instead of black.
+#define FB_INTENSITY_DEFAULT_TINT 0xFFFF
+
 // Target frame rate
 #define TARGET_FPS 30
 #define TARGET_FRAME_TIME_MS (1000 / TARGET_FPS)
 
+// Quality governor: when the rolling average frame time (update +
+// render) stays over TARGET_FRAME_TIME_MS, step down the quality
+// ladder (fewer particles, smaller sprites, shorter trails); step back
+// up after a longer stretch under QUALITY_RAISE_PERCENT of the budget.
+// The level is reported to the server. Comment out to stay at full
+// quality.
+#define QUALITY_GOVERNOR
+#define QUALITY_DROP_FRAMES 15
+#define QUALITY_RAISE_FRAMES 90
+#define QUALITY_RAISE_PERCENT 70
+
 // ============================================
 // Noise Configuration
 // ============================================
@@ -117,6 +173,16 @@
 // Number of noise octaves for fractal noise
 #define NOISE_OCTAVES 2
 
+// Flow field: curl noise is cached on a coarse grid of nodes over the
+// screen (FLOW_FIELD_SIZE^2 * 8 bytes of SRAM), refreshed a few rows per
+// frame, and particles interpolate it bilinearly. Noise cost per frame
+// is then fixed regardless of particle count; particles share one field
+// instead of each wandering its own offset. Comment out to evaluate
+// curl noise per particle.
+#define NOISE_FLOW_FIELD
+#define FLOW_FIELD_SIZE 32
+#define FLOW_FIELD_ROWS_PER_FRAME 4
+
 // ============================================
 // Color Defaults
 // ============================================
@@ -144,8 +210,77 @@
 // Memory Configuration
 // ============================================
 
-// Framebuffer size (466 * 466 * 2 bytes = 434,312 bytes)
-#define FRAMEBUFFER_SIZE (SCREEN_WIDTH * SCREEN_HEIGHT * 2)
+// Render scale: the framebuffer is the screen shrunk by 2^SHIFT on
+// each side and every pixel is pushed as a 2^SHIFT square. At 1 it is
+// 234x233 (width kept even for word-aligned rows), so fades and blends
+// touch a quarter of the pixels and sprites are rendered at half size;
+// soft particles and trails hide the lower resolution. 0 = native.
+#define FB_RENDER_SHIFT 0
+#define FB_WIDTH ((((SCREEN_WIDTH + (1 << FB_RENDER_SHIFT) - 1) >> FB_RENDER_SHIFT) + 1) & ~1)
+#define FB_HEIGHT ((SCREEN_HEIGHT + (1 << FB_RENDER_SHIFT) - 1) >> FB_RENDER_SHIFT)
+
+// Framebuffer size (466 * 466 * 2 bytes = 434,312 bytes at native
+// scale, or half that with FB_INTENSITY_RENDER)
+#ifdef FB_INTENSITY_RENDER
+#define FRAMEBUFFER_SIZE (FB_WIDTH * FB_HEIGHT)
+#else
+#define FRAMEBUFFER_SIZE (FB_WIDTH * FB_HEIGHT * 2)
+#endif
+
+// Dirty-tile size for partial display pushes (16x16 screen pixels at
+// any render scale). Tile edges stay even, which keeps CO5300 address
+// windows aligned
+#define FB_TILE_SHIFT (4 - FB_RENDER_SHIFT)
+#define FB_TILE_SIZE (1 << FB_TILE_SHIFT)
+#define FB_TILES_X ((FB_WIDTH + FB_TILE_SIZE - 1) / FB_TILE_SIZE)
+#define FB_TILES_Y ((FB_HEIGHT + FB_TILE_SIZE - 1) / FB_TILE_SIZE)
+
+// Double-buffer the framebuffer and push finished frames from a task
+// on the other core, so the next frame renders during the transfer.
+// Costs a second FRAMEBUFFER_SIZE of PSRAM. Comment out for blocking push.
+#define FRAMEBUFFER_ASYNC_PUSH
+
+// Tiled rendering: particle draws are binned per tile row, then each
+// tile-row band is faded and composited in internal SRAM and written
+// back to PSRAM in row bursts. Costs ~21 KB of internal RAM.
+// Comment out to fade and blend directly in PSRAM.
+#define FB_TILED_RENDER
+
+// Particle draws queued per frame in tiled mode (extras draw directly)
+#define FB_DRAW_LIST_SIZE MAX_PARTICLES
+
+// Core and priority of the display push task: core 0, above the
+// network task (priority 1), so a push preempts network polling
+// while rendering continues on core 1
+#define DISPLAY_PUSH_CORE 0
+#define DISPLAY_PUSH_PRIORITY 2
+#define DISPLAY_PUSH_STACK 4096
+
+// ============================================
+// Memory
+// ============================================
+
+// Alignment of every boot-time buffer (src/memory_arena.h): a PSRAM
+// cache line, so DMA from any of them starts on a line of its own
+#define MEMORY_ALIGN 64
+
+// ============================================
+// Task Configuration
+// ============================================
+
+// Network task: WiFi, WebSocket polling, JSON parsing
+// (core 0, alongside the WiFi stack)
+#define NETWORK_TASK_CORE 0
+#define NETWORK_TASK_PRIORITY 1
+#define NETWORK_TASK_STACK 8192
+
+// Render task: physics, rasterization
+#define RENDER_TASK_CORE 1
+#define RENDER_TASK_PRIORITY 2
+#define RENDER_TASK_STACK 8192
+
+// Network -> render command queue depth (power of two)
+#define COMMAND_QUEUE_SIZE 32
 
 // ============================================
 // Debug Configuration
@@ -164,7 +299,22 @@
   #define DEBUG_PRINTF(...)
 #endif
 
+// How long setup() waits for the USB serial monitor to attach (ms);
+// raise it to catch the boot log, 0 boots without waiting
+#define SERIAL_WAIT_MS 0
+
 // FPS reporting interval (ms)
 #define FPS_REPORT_INTERVAL_MS 5000
 
+// Stage profiler (debug builds): samples kept per stage (power of
+// two), and how often the stats are sent to the server (ms)
+#define PROFILE_SAMPLES 128
+#define PROFILE_REPORT_INTERVAL_MS 5000
+
+// Record every server message, with its arrival time, into a PSRAM
+// ring (oldest dropped when full) that can be dumped and replayed
+// from the serial console. Uncomment to enable
+// #define MESSAGE_LOG
+#define MESSAGE_LOG_SIZE (128 * 1024)
+
 #endif // CONFIG_H
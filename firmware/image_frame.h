@@ -0,0 +1,193 @@
+#ifndef IMAGE_FRAME_H
+#define IMAGE_FRAME_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * Binary Image Frames
+ *
+ * Images arrive as binary WebSocket messages: a fixed 12-byte
+ * little-endian header followed by a body, row-major, no padding.
+ *
+ *   offset  size  field
+ *        0     1  type      (IMAGE_FRAME_TYPE_*)
+ *        1     1  format    (ImagePixelFormat)
+ *        2     2  width     (pixels)
+ *        4     2  height    (pixels)
+ *        6     2  reserved  (0)
+ *        8     4  sequence  (incremented by the server per image)
+ *       12     -  body
+ *
+ * A full image (IMAGE_FRAME_TYPE_IMAGE) body is:
+ *   [palette]  pixels (width * height)
+ *
+ * A delta (IMAGE_FRAME_TYPE_DELTA) replaces whole 8x8 tiles of the
+ * image whose sequence number is base; its body is:
+ *   base (4)  tile count (2)  [palette]
+ *   per tile: tile x (1)  tile y (1)  pixels (tile width * height)
+ * Tiles on the right and bottom edges are clipped to the image.
+ *
+ * The palette is present only for IMAGE_FORMAT_INDEXED8: an entry
+ * count minus one (1 byte), then that many r, g, b triplets. Pixels
+ * are then one palette index each.
+ *
+ * Parsing never copies: the frame's pointers are views into the
+ * message buffer, valid for as long as the message is.
+ */
+
+#define IMAGE_FRAME_TYPE_IMAGE 1
+#define IMAGE_FRAME_TYPE_DELTA 2
+#define IMAGE_FRAME_HEADER_SIZE 12
+#define IMAGE_FRAME_MAX_DIM 256
+#define IMAGE_DELTA_TILE_SHIFT 3
+#define IMAGE_DELTA_TILE_SIZE (1 << IMAGE_DELTA_TILE_SHIFT)
+
+enum ImagePixelFormat : uint8_t {
+    IMAGE_FORMAT_RGB888 = 0,   // r, g, b bytes
+    IMAGE_FORMAT_RGB565 = 1,   // uint16 little-endian, 5-6-5
+    IMAGE_FORMAT_INDEXED8 = 2, // palette index
+};
+
+struct ImageFrame {
+    uint8_t type;              // IMAGE_FRAME_TYPE_*
+    uint32_t sequence;
+    uint16_t width;
+    uint16_t height;
+    ImagePixelFormat format;
+    const uint8_t* palette;    // r, g, b triplets (indexed only)
+    uint16_t paletteSize;
+    const uint8_t* pixels;     // Image pixels, or the first delta tile
+
+    // Deltas only
+    uint32_t baseSequence;
+    uint16_t tileCount;
+};
+
+/**
+ * Bytes per pixel for a format (0 if unknown).
+ */
+static inline size_t image_bytes_per_pixel(uint8_t format) {
+    switch (format) {
+        case IMAGE_FORMAT_RGB888: return 3;
+        case IMAGE_FORMAT_RGB565: return 2;
+        case IMAGE_FORMAT_INDEXED8: return 1;
+        default: return 0;
+    }
+}
+
+/**
+ * Read pixel i of a pixel run as 8-bit RGB.
+ */
+static inline void image_read_pixel(const ImageFrame& frame, const uint8_t* pixels, size_t i,
+                                    uint8_t& r, uint8_t& g, uint8_t& b) {
+    if (frame.format == IMAGE_FORMAT_INDEXED8) {
+        uint8_t index = pixels[i];
+        if (index >= frame.paletteSize) index = 0;  // Out of palette
+        const uint8_t* entry = frame.palette + index * 3;
+        r = entry[0];
+        g = entry[1];
+        b = entry[2];
+    } else if (frame.format == IMAGE_FORMAT_RGB565) {
+        uint16_t c = (uint16_t)(pixels[i * 2] | (pixels[i * 2 + 1] << 8));
+        uint8_t r5 = c >> 11, g6 = (c >> 5) & 0x3F, b5 = c & 0x1F;
+        r = (r5 << 3) | (r5 >> 2);
+        g = (g6 << 2) | (g6 >> 4);
+        b = (b5 << 3) | (b5 >> 2);
+    } else {
+        r = pixels[i * 3];
+        g = pixels[i * 3 + 1];
+        b = pixels[i * 3 + 2];
+    }
+}
+
+/**
+ * Width and height of delta tile (tx, ty), clipped to the image.
+ */
+static inline void image_delta_tile_size(const ImageFrame& frame, uint8_t tx, uint8_t ty,
+                                         uint16_t& w, uint16_t& h) {
+    uint16_t x = (uint16_t)tx << IMAGE_DELTA_TILE_SHIFT;
+    uint16_t y = (uint16_t)ty << IMAGE_DELTA_TILE_SHIFT;
+    w = (frame.width - x < IMAGE_DELTA_TILE_SIZE) ? frame.width - x : IMAGE_DELTA_TILE_SIZE;
+    h = (frame.height - y < IMAGE_DELTA_TILE_SIZE) ? frame.height - y : IMAGE_DELTA_TILE_SIZE;
+}
+
+/**
+ * Read a little-endian uint32 from an unaligned pointer.
+ */
+static inline uint32_t image_read_u32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * Validate a binary message and view it as an image frame.
+ * For deltas every tile is bounds-checked, so callers can walk them
+ * with image_delta_tile_size() without further checks.
+ *
+ * @param data   Message bytes
+ * @param len    Message length
+ * @param frame  Filled in on success (pointers into data)
+ * @return true if the header is valid and the whole body is present
+ */
+static inline bool image_frame_parse(const uint8_t* data, size_t len, ImageFrame* frame) {
+    if (!data || !frame || len < IMAGE_FRAME_HEADER_SIZE) return false;
+
+    uint8_t type = data[0];
+    if (type != IMAGE_FRAME_TYPE_IMAGE && type != IMAGE_FRAME_TYPE_DELTA) return false;
+
+    size_t bpp = image_bytes_per_pixel(data[1]);
+    uint16_t width = (uint16_t)(data[2] | (data[3] << 8));
+    uint16_t height = (uint16_t)(data[4] | (data[5] << 8));
+    if (bpp == 0 || width == 0 || height == 0) return false;
+    if (width > IMAGE_FRAME_MAX_DIM || height > IMAGE_FRAME_MAX_DIM) return false;
+
+    frame->type = type;
+    frame->format = (ImagePixelFormat)data[1];
+    frame->width = width;
+    frame->height = height;
+    frame->sequence = image_read_u32(data + 8);
+    frame->palette = nullptr;
+    frame->paletteSize = 0;
+    frame->baseSequence = 0;
+    frame->tileCount = 0;
+
+    const uint8_t* p = data + IMAGE_FRAME_HEADER_SIZE;
+    const uint8_t* end = data + len;
+
+    if (type == IMAGE_FRAME_TYPE_DELTA) {
+        if (end - p < 6) return false;
+        frame->baseSequence = image_read_u32(p);
+        frame->tileCount = (uint16_t)(p[4] | (p[5] << 8));
+        p += 6;
+    }
+
+    if (frame->format == IMAGE_FORMAT_INDEXED8) {
+        if (end - p < 1) return false;
+        uint16_t entries = (uint16_t)p[0] + 1;
+        if ((size_t)(end - p - 1) < entries * 3u) return false;
+        frame->palette = p + 1;
+        frame->paletteSize = entries;
+        p += 1 + entries * 3;
+    }
+
+    frame->pixels = p;
+
+    if (type == IMAGE_FRAME_TYPE_IMAGE) {
+        if ((size_t)(end - p) < (size_t)width * height * bpp) return false;
+    } else {
+        uint16_t tilesX = (width + IMAGE_DELTA_TILE_SIZE - 1) >> IMAGE_DELTA_TILE_SHIFT;
+        uint16_t tilesY = (height + IMAGE_DELTA_TILE_SIZE - 1) >> IMAGE_DELTA_TILE_SHIFT;
+        for (uint16_t t = 0; t < frame->tileCount; t++) {
+            if (end - p < 2 || p[0] >= tilesX || p[1] >= tilesY) return false;
+            uint16_t w, h;
+            image_delta_tile_size(*frame, p[0], p[1], w, h);
+            size_t bytes = (size_t)w * h * bpp;
+            if ((size_t)(end - p - 2) < bytes) return false;
+            p += 2 + bytes;
+        }
+    }
+
+    return true;
+}
+
+#endif // IMAGE_FRAME_H
@@ -2,41 +2,65 @@
 #define PARTICLE_SYSTEM_H
 
 #include <Arduino.h>
-#include <Arduino_GFX_Library.h>
 #include "config.h"
+#include "image_frame.h"
+#include "src/fixed_math.h"
+#include "src/framebuffer.h"
+#include "src/memory_arena.h"
+#include "src/morton.h"
+#include "src/spatial_grid.h"
+#include "src/sprites.h"
 
 // ============================================
 // Particle Structure
 // ============================================
 
+// Positions, radii and opacity are 16.16 fixed-point. Angles are
+// 16-bit binary angles (65536 = one turn, the fixed_sin() input), so
+// they wrap for free and advance by one add per frame.
 struct Particle {
     // Current position (screen space)
-    float x, y, z;
+    fixed_t x, y, z;
+
+    // Position before the last physics step, and the position drawn
+    // this frame (interpolated between the two)
+    fixed_t prevX, prevY;
+    fixed_t drawX, drawY;
 
     // Home position from image (what particle returns to)
-    float homeX, homeY, homeZ;
+    fixed_t homeX, homeY, homeZ;
 
     // Target home (for morphing to new image)
-    float targetHomeX, targetHomeY, targetHomeZ;
+    fixed_t targetHomeX, targetHomeY, targetHomeZ;
     bool morphing;
 
-    // Orbit angles for animation
-    float angleXY;
-    float angleXZ;
-    float angularSpeedXY;
-    float angularSpeedXZ;
-    float orbitRadius;
+    // Home relative to screen center: unit direction and distance,
+    // refreshed whenever the home moves
+    fixed_t homeDirX, homeDirY;
+    fixed_t homeDist;
+
+    // Orbit angles for animation (drift runs at 0.3x the orbit rate)
+    uint16_t angleXY;
+    uint16_t angleXZ;
+    uint16_t driftXY;
+    uint16_t driftXZ;
+    fixed_t angularSpeedXY;  // Turns per second
+    fixed_t angularSpeedXZ;
+    fixed_t orbitRadius;
 
     // Color from source image
     uint8_t r, g, b;
     uint8_t targetR, targetG, targetB;
 
     // Per-particle opacity (for fade in/out)
-    float opacity;
-    float targetOpacity;
+    fixed_t opacity;
+    fixed_t targetOpacity;
 
     // Random offset for variation
-    float phase;
+    uint16_t phase;
+
+    // Source pixel in the image (-1 = not sampled from an image)
+    int16_t srcX, srcY;
 };
 
 // ============================================
@@ -87,11 +111,20 @@ public:
         particles = nullptr;
         activeCount = 0;
         globalRotation = 0.0f;
-        pulsePhase = 0.0f;
+        pulsePhase = 0;
         _clearing = false;
         _startupPhase = 0.0f;
         _startupActive = false;
+        _stepAccumUs = 0;
+        _renderAlpha = 0;
         _hasImage = false;
+        _imageSequence = 0;
+        _imageSequenceValid = false;
+        _imageW = 0;
+        _imageH = 0;
+        _brightnessSum = nullptr;
+        _sortKeys = nullptr;
+        _sortIds = nullptr;
 
         // Default config
         config.particle_count = DEFAULT_PARTICLE_COUNT;
@@ -112,15 +145,31 @@ public:
     }
 
     /**
-     * Initialize — allocate particle array in PSRAM.
+     * Initialize — allocate the particle array (PSRAM) and image
+     * ingest buffers, and build the shape sprites used by render().
      * Must be called once after PSRAM is available.
      */
     bool init() {
-        particles = (Particle*)ps_malloc(sizeof(Particle) * MAX_PARTICLES);
+        particles = (Particle*)memoryArena.alloc(ARENA_IMAGE_ENGINE, sizeof(Particle) * MAX_PARTICLES,
+                                                 ARENA_PSRAM);
         if (!particles) {
             Serial.println("ERROR: Failed to allocate particle array in PSRAM");
             return false;
         }
+        size_t imagePixels = IMAGE_FRAME_MAX_DIM * IMAGE_FRAME_MAX_DIM;
+        _brightnessSum = (uint32_t*)memoryArena.alloc(ARENA_IMAGE_ENGINE, sizeof(uint32_t) * imagePixels,
+                                                      ARENA_PSRAM);
+        _sortKeys = (uint32_t*)memoryArena.alloc(ARENA_IMAGE_ENGINE, sizeof(uint32_t) * 3 * MAX_PARTICLES,
+                                                 ARENA_INTERNAL);
+        _sortIds = (uint16_t*)memoryArena.alloc(ARENA_IMAGE_ENGINE, sizeof(uint16_t) * 3 * MAX_PARTICLES,
+                                                ARENA_INTERNAL);
+        if (!_brightnessSum || !_sortKeys || !_sortIds) {
+            Serial.println("ERROR: Failed to allocate image ingest buffers");
+            return false;
+        }
+        if (!_shapes.generate()) {
+            return false;
+        }
         memset(particles, 0, sizeof(Particle) * MAX_PARTICLES);
 
         Serial.printf("Particle system: %d bytes allocated in PSRAM\n",
@@ -129,29 +178,58 @@ public:
     }
 
     /**
-     * Create particles from raw RGB image data.
+     * Create particles from raw RGB888 or RGB565 image data.
+     */
+    void createFromImage(const uint8_t* pixels, int imgW, int imgH,
+                         ImagePixelFormat format = IMAGE_FORMAT_RGB888) {
+        ImageFrame frame = {};
+        frame.type = IMAGE_FRAME_TYPE_IMAGE;
+        frame.width = imgW;
+        frame.height = imgH;
+        frame.format = format;
+        frame.pixels = pixels;
+        createFromFrame(frame);
+
+        // Not from a numbered frame, so no delta can build on it
+        _imageSequenceValid = false;
+    }
+
+    /**
+     * Create particles from a full binary image frame (any format).
      * Samples non-black pixels, assigns colors, maps to screen space.
+     * The pixels are read in place from the message buffer (no copy).
+     *
+     * One pass over the image builds a prefix sum of pixel brightness,
+     * and the particles are spread evenly along it, so brighter areas
+     * get more of them. The samples and the particles already shown
+     * are both sorted along a Morton curve and paired by rank, so each
+     * particle morphs to a nearby new home. The particle array is
+     * stored in that order too, which keeps the update and render
+     * loops walking the screen coherently.
      */
-    void createFromImage(uint8_t* rgbData, int imgW, int imgH) {
-        if (!particles || !rgbData) return;
+    void createFromFrame(const ImageFrame& frame) {
+        const uint8_t* pixels = frame.pixels;
+        if (!particles || !pixels) return;
 
-        // First pass: count non-black pixels and build candidate list
-        // We'll sample from non-black pixels to fill particle_count particles
+        int imgW = frame.width;
+        int imgH = frame.height;
         int totalPixels = imgW * imgH;
+        if (totalPixels == 0 || imgW > IMAGE_FRAME_MAX_DIM || imgH > IMAGE_FRAME_MAX_DIM) return;
         int targetCount = min(targetConfig.particle_count, MAX_PARTICLES);
 
-        // Collect non-black pixel indices
-        // Use a simple brightness threshold to skip near-black pixels
-        const int BRIGHTNESS_THRESHOLD = 15;
-
-        // Count valid pixels first
+        // Running brightness of the lit pixels
+        // (IMAGE_BRIGHTNESS_THRESHOLD skips near-black pixels)
         int validCount = 0;
+        uint32_t brightnessSum = 0;
         for (int i = 0; i < totalPixels; i++) {
-            int idx = i * 3;
-            int brightness = (int)rgbData[idx] + rgbData[idx + 1] + rgbData[idx + 2];
-            if (brightness > BRIGHTNESS_THRESHOLD) {
+            uint8_t r, g, b;
+            image_read_pixel(frame, pixels, i, r, g, b);
+            int brightness = (int)r + g + b;
+            if (brightness > IMAGE_BRIGHTNESS_THRESHOLD) {
+                brightnessSum += brightness;
                 validCount++;
             }
+            _brightnessSum[i] = brightnessSum;
         }
 
         if (validCount == 0) {
@@ -162,15 +240,16 @@ public:
                     SCREEN_HEIGHT / 2.0f + random(-50, 50),
                     30, 30, 40);  // dim blue-ish
             }
+            for (int i = min(targetCount, 100); i < activeCount; i++) {
+                particles[i].srcX = -1;
+                particles[i].srcY = -1;
+            }
             activeCount = min(targetCount, 100);
             _hasImage = true;
+            _setImage(frame);
             return;
         }
 
-        // Calculate sampling stride
-        float stride = (float)validCount / (float)targetCount;
-        if (stride < 1.0f) stride = 1.0f;
-
         // Scale factors: image coords → screen coords
         // Center the image on screen with some padding
         float scaleX = (float)SCREEN_WIDTH * 0.85f / (float)imgW;
@@ -179,69 +258,162 @@ public:
         float offsetX = (SCREEN_WIDTH - imgW * scale) / 2.0f;
         float offsetY = (SCREEN_HEIGHT - imgH * scale) / 2.0f;
 
-        int particleIdx = 0;
-        float accumulator = 0.0f;
-        int validIdx = 0;
+        uint32_t* sampleKeys = _sortKeys;
+        uint16_t* samplePixels = _sortIds;
+        int sampleCount = _samplePixels(totalPixels, validCount, min(targetCount, validCount), samplePixels);
+        for (int j = 0; j < sampleCount; j++) {
+            int px = samplePixels[j] % imgW;
+            int py = samplePixels[j] / imgW;
+            sampleKeys[j] = morton_key((int)(offsetX + px * scale), (int)(offsetY + py * scale));
+        }
+        morton_sort(sampleKeys, samplePixels, sampleCount, _sortKeys + 2 * MAX_PARTICLES,
+                    _sortIds + 2 * MAX_PARTICLES);
+
+        // Move the particles already shown to the slots of their new
+        // homes; samples no particle moves to get a new one
+        int morphCount = 0;
+        if (_hasImage) {
+            morphCount = _assignParticles(sampleCount);
+        } else {
+            for (int j = 0; j < sampleCount; j++) sampleKeys[j] |= SAMPLE_SPAWN;
+        }
 
-        for (int i = 0; i < totalPixels && particleIdx < targetCount; i++) {
-            int idx = i * 3;
-            int brightness = (int)rgbData[idx] + rgbData[idx + 1] + rgbData[idx + 2];
+        for (int j = 0; j < sampleCount; j++) {
+            uint8_t r, g, b;
+            image_read_pixel(frame, pixels, samplePixels[j], r, g, b);
+
+            // Pixel position in image space
+            int px = samplePixels[j] % imgW;
+            int py = samplePixels[j] / imgW;
+
+            // Map to screen space
+            float screenX = offsetX + px * scale;
+            float screenY = offsetY + py * scale;
+
+            Particle& p = particles[j];
+
+            if (!(sampleKeys[j] & SAMPLE_SPAWN)) {
+                // Existing particle: morph to new position
+                p.targetHomeX = FLOAT_TO_FIXED(screenX);
+                p.targetHomeY = FLOAT_TO_FIXED(screenY);
+                p.targetHomeZ = 0;
+                p.targetR = r;
+                p.targetG = g;
+                p.targetB = b;
+                p.morphing = true;
+                p.targetOpacity = FIXED_ONE;
+            } else {
+                // New particle: spawn at center, morph outward
+                _initParticle(j, screenX, screenY, r, g, b);
+
+                if (_hasImage) {
+                    // Spawn from center for dramatic effect
+                    p.x = INT_TO_FIXED(SCREEN_WIDTH) / 2;
+                    p.y = INT_TO_FIXED(SCREEN_HEIGHT) / 2;
+                    p.prevX = p.x;
+                    p.prevY = p.y;
+                }
+            }
+
+            p.srcX = px;
+            p.srcY = py;
+        }
 
-            if (brightness <= BRIGHTNESS_THRESHOLD) continue;
+        // Handle particles that are no longer needed (moved past the
+        // samples by _assignParticles())
+        // No longer part of the image, so deltas leave them alone
+        for (int i = sampleCount; i < activeCount; i++) {
+            particles[i].targetOpacity = 0;
+            particles[i].morphing = false;
+            particles[i].srcX = -1;
+            particles[i].srcY = -1;
+        }
+
+        activeCount = max(sampleCount, activeCount);
+        _hasImage = true;
+        _clearing = false;
+        _setImage(frame);
 
-            accumulator += 1.0f;
-            if (accumulator >= stride) {
-                accumulator -= stride;
+        Serial.printf("Particles: %d active from %dx%d image (%d valid pixels, %d morphing)\n",
+                         sampleCount, imgW, imgH, validCount, morphCount);
+    }
 
-                // Pixel position in image space
-                int px = i % imgW;
-                int py = i / imgW;
+    /**
+     * Apply a delta frame to the current image. Only particles sampled
+     * from a replaced tile are touched: they take the new pixel color,
+     * or fade out if it went dark. Homes stay where they are.
+     * A tile that lights pixels but has no particle sampled from it
+     * (e.g. on an all-black base image) can't be shown this way, so
+     * the whole delta is rejected before anything changes.
+     * @return false if the delta does not build on the current image
+     *         or needs new particles (the server should then send a
+     *         full frame)
+     */
+    bool applyDelta(const ImageFrame& delta) {
+        if (!particles || !_hasImage || !_imageSequenceValid) return false;
+        if (delta.baseSequence != _imageSequence) return false;
+        if (delta.width != _imageW || delta.height != _imageH) return false;
 
-                // Map to screen space
-                float screenX = offsetX + px * scale;
-                float screenY = offsetY + py * scale;
+        size_t bpp = image_bytes_per_pixel(delta.format);
 
-                // Set up particle — morph from current position if already active
-                Particle& p = particles[particleIdx];
+        // Tiles holding a particle of the image, one bit per tile column
+        uint32_t occupied[DELTA_TILE_ROWS] = {};
+        for (int i = 0; i < activeCount; i++) {
+            const Particle& p = particles[i];
+            if (p.srcX < 0) continue;
+            occupied[p.srcY >> IMAGE_DELTA_TILE_SHIFT] |= 1u << (p.srcX >> IMAGE_DELTA_TILE_SHIFT);
+        }
 
-                if (_hasImage && particleIdx < activeCount) {
-                    // Existing particle: morph to new position
-                    p.targetHomeX = screenX;
-                    p.targetHomeY = screenY;
-                    p.targetHomeZ = 0.0f;
-                    p.targetR = rgbData[idx];
-                    p.targetG = rgbData[idx + 1];
-                    p.targetB = rgbData[idx + 2];
+        const uint8_t* tile = delta.pixels;
+        for (uint16_t t = 0; t < delta.tileCount; t++) {
+            uint16_t w, h;
+            image_delta_tile_size(delta, tile[0], tile[1], w, h);
+            if (!(occupied[tile[1]] & (1u << tile[0])) && _tileLit(delta, tile + 2, w * h)) {
+                Serial.printf("Particles: delta #%u lights tile %u,%u, which has no particles\n",
+                                 (unsigned)delta.sequence, tile[0], tile[1]);
+                return false;
+            }
+            tile += 2 + (size_t)w * h * bpp;
+        }
+
+        tile = delta.pixels;
+        int updated = 0;
+
+        for (uint16_t t = 0; t < delta.tileCount; t++) {
+            uint16_t w, h;
+            image_delta_tile_size(delta, tile[0], tile[1], w, h);
+            int x0 = tile[0] << IMAGE_DELTA_TILE_SHIFT;
+            int y0 = tile[1] << IMAGE_DELTA_TILE_SHIFT;
+            const uint8_t* pixels = tile + 2;
+
+            for (int i = 0; i < activeCount; i++) {
+                Particle& p = particles[i];
+                unsigned dx = (unsigned)(p.srcX - x0);
+                unsigned dy = (unsigned)(p.srcY - y0);
+                if (p.srcX < 0 || dx >= w || dy >= h) continue;
+
+                uint8_t r, g, b;
+                image_read_pixel(delta, pixels, dy * w + dx, r, g, b);
+                if ((int)r + g + b > IMAGE_BRIGHTNESS_THRESHOLD) {
+                    p.targetR = r;
+                    p.targetG = g;
+                    p.targetB = b;
                     p.morphing = true;
-                    p.targetOpacity = 1.0f;
+                    p.targetOpacity = FIXED_ONE;
                 } else {
-                    // New particle: spawn at center, morph outward
-                    _initParticle(particleIdx, screenX, screenY,
-                                  rgbData[idx], rgbData[idx + 1], rgbData[idx + 2]);
-
-                    if (_hasImage) {
-                        // Spawn from center for dramatic effect
-                        p.x = SCREEN_WIDTH / 2.0f;
-                        p.y = SCREEN_HEIGHT / 2.0f;
-                    }
+                    p.targetOpacity = 0;
                 }
-
-                particleIdx++;
+                updated++;
             }
-        }
 
-        // Handle particles that are no longer needed
-        for (int i = particleIdx; i < activeCount; i++) {
-            particles[i].targetOpacity = 0.0f;
-            particles[i].morphing = false;
+            tile += 2 + (size_t)w * h * bpp;
         }
 
-        activeCount = max(particleIdx, activeCount);
-        _hasImage = true;
-        _clearing = false;
+        _imageSequence = delta.sequence;
 
-        Serial.printf("Particles: %d active from %dx%d image (%d valid pixels)\n",
-                         particleIdx, imgW, imgH, validCount);
+        Serial.printf("Particles: delta #%u, %d tiles, %d particles updated\n",
+                         (unsigned)delta.sequence, delta.tileCount, updated);
+        return true;
     }
 
     /**
@@ -303,10 +475,287 @@ public:
 
     /**
      * Update physics — call every frame with delta time in seconds.
+     * The time is simulated in fixed steps of 1/PHYSICS_HZ (at most
+     * PHYSICS_MAX_STEPS per call, the rest is dropped); what is left
+     * over sets how far render() interpolates into the next step.
      */
     void update(float dt) {
         if (!particles) return;
 
+        const uint32_t stepUs = 1000000 / PHYSICS_HZ;
+        _stepAccumUs += (uint32_t)(dt * 1000000.0f + 0.5f);
+        for (int steps = 0; _stepAccumUs >= stepUs; steps++) {
+            if (steps == PHYSICS_MAX_STEPS) {
+                _stepAccumUs %= stepUs;
+                break;
+            }
+            _step(stepUs / 1000000.0f);
+            _stepAccumUs -= stepUs;
+        }
+        _renderAlpha = (fixed_t)(((uint64_t)_stepAccumUs << FIXED_SHIFT) / stepUs);
+    }
+
+    /**
+     * Render all particles into the framebuffer and push one frame.
+     * Shapes go through the sprite blitter, so the whole frame costs
+     * a single (dirty-tile) transfer however many particles it has.
+     */
+    void render(Framebuffer& fb) {
+        if (!particles || !fb.isValid()) return;
+
+        // Clear background (black only rewrites what the last frame lit)
+        fb.clear(config.bg_color);
+
+        int effectiveCount = min(activeCount, (int)MAX_PARTICLES);
+        int size = constrain((int)(config.particle_size + 0.5f), 1, SHAPE_SPRITE_MAX_RADIUS);
+
+        // Star falls back to the circle sprite
+        uint8_t shape = (config.shape == SHAPE_SQUARE) ? SPRITE_SHAPE_SQUARE : SPRITE_SHAPE_CIRCLE;
+        SpriteRef sprite = _shapes.get(shape, size);
+        const fixed_t OPACITY_VISIBLE = FLOAT_TO_FIXED(0.05f);
+
+        for (int i = 0; i < effectiveCount; i++) {
+            Particle& p = particles[i];
+
+            // Between the last two physics steps (links use this too)
+            p.drawX = p.prevX + fixed_mul(p.x - p.prevX, _renderAlpha);
+            p.drawY = p.prevY + fixed_mul(p.y - p.prevY, _renderAlpha);
+
+            if (p.opacity < OPACITY_VISIBLE) continue;
+
+            // Screen bounds check
+            int sx = FIXED_TO_INT_ROUND(p.drawX);
+            int sy = FIXED_TO_INT_ROUND(p.drawY);
+
+            if (sx < -size || sx >= SCREEN_WIDTH + size ||
+                sy < -size || sy >= SCREEN_HEIGHT + size) {
+                continue;
+            }
+
+            // Opacity scales the sprite instead of the color
+            uint16_t color = _rgb565(p.r, p.g, p.b);
+            uint8_t brightness = (uint8_t)((fixed_min(FIXED_ONE, p.opacity) * 255) >> FIXED_SHIFT);
+
+            fb.drawSprite(sx - size, sy - size, sprite, color, brightness);
+        }
+
+        // Draw links between nearby particles (if enabled)
+        if (config.link_count > 0 && config.link_opacity > 0.01f) {
+            _renderLinks(fb, effectiveCount);
+        }
+
+        fb.pushToDisplay();
+    }
+
+    /**
+     * Start clearing — fade all particles out.
+     */
+    void clear() {
+        _clearing = true;
+    }
+
+    /**
+     * Start the startup animation (particles emerge from center).
+     */
+    void startStartup() {
+        _startupActive = true;
+        _startupPhase = 0.0f;
+
+        // Create some initial particles at center
+        int count = min(DEFAULT_PARTICLE_COUNT, MAX_PARTICLES);
+        float centerX = SCREEN_WIDTH / 2.0f;
+        float centerY = SCREEN_HEIGHT / 2.0f;
+
+        for (int i = 0; i < count; i++) {
+            _initParticle(i,
+                centerX + random(-SCREEN_WIDTH / 3, SCREEN_WIDTH / 3),
+                centerY + random(-SCREEN_HEIGHT / 3, SCREEN_HEIGHT / 3),
+                0, 200 + random(55), 200 + random(55));  // Cyan-ish
+
+            // Start all at center
+            particles[i].x = FLOAT_TO_FIXED(centerX);
+            particles[i].y = FLOAT_TO_FIXED(centerY);
+            particles[i].prevX = particles[i].x;
+            particles[i].prevY = particles[i].y;
+            particles[i].opacity = 0;
+            particles[i].targetOpacity = FLOAT_TO_FIXED(0.8f);
+        }
+
+        activeCount = count;
+        _hasImage = false;
+    }
+
+    // Accessors
+    int getActiveCount() const { return activeCount; }
+    bool hasImage() const { return _hasImage; }
+    bool isClearing() const { return _clearing; }
+    const ParticleConfig& getConfig() const { return config; }
+
+private:
+    Particle* particles;
+    int activeCount;
+    ParticleConfig config;
+    ParticleConfig targetConfig;
+    float globalRotation;
+    uint16_t pulsePhase;     // Binary angle (65536 = 2*PI)
+    bool _clearing;
+    float _startupPhase;
+    bool _startupActive;
+    uint32_t _stepAccumUs;   // Time not yet simulated (under one step)
+    fixed_t _renderAlpha;    // The same as a fraction of a step
+    bool _hasImage;
+    uint32_t _imageSequence;     // Frame the current image came from
+    bool _imageSequenceValid;
+    uint16_t _imageW, _imageH;
+    ShapeSprites _shapes;
+    SpatialGrid<MAX_PARTICLES> _grid;  // Rebuilt per frame for links
+
+    // Pixels this dark (r + g + b) are background, not particles
+    static const int IMAGE_BRIGHTNESS_THRESHOLD = 15;
+
+    // Delta tile rows (and columns, see applyDelta()) of the largest image
+    static const int DELTA_TILE_ROWS = IMAGE_FRAME_MAX_DIM >> IMAGE_DELTA_TILE_SHIFT;
+    static_assert(DELTA_TILE_ROWS <= 32, "a tile row must fit one uint32_t mask");
+
+    // Sample key flag: no particle moves here, spawn a new one
+    static const uint32_t SAMPLE_SPAWN = 1u << 31;
+
+    // Ingest scratch: brightness prefix sum per pixel, and three
+    // MAX_PARTICLES slices of Morton keys and ids (samples, particles,
+    // sort buffer)
+    uint32_t* _brightnessSum;
+    uint32_t* _sortKeys;
+    uint16_t* _sortIds;
+
+    static_assert(IMAGE_FRAME_MAX_DIM * IMAGE_FRAME_MAX_DIM <= 0x10000, "pixel indices must fit uint16_t");
+
+    /**
+     * Remember which frame the particles were sampled from.
+     */
+    void _setImage(const ImageFrame& frame) {
+        _imageSequence = frame.sequence;
+        _imageSequenceValid = true;
+        _imageW = frame.width;
+        _imageH = frame.height;
+    }
+
+    /**
+     * Check whether any of a delta tile's count pixels is lit.
+     */
+    static bool _tileLit(const ImageFrame& delta, const uint8_t* pixels, int count) {
+        for (int i = 0; i < count; i++) {
+            uint8_t r, g, b;
+            image_read_pixel(delta, pixels, i, r, g, b);
+            if ((int)r + g + b > IMAGE_BRIGHTNESS_THRESHOLD) return true;
+        }
+        return false;
+    }
+
+    /**
+     * Pick count lit pixels spread evenly along the brightness prefix
+     * sum (the point in the middle of each of count equal slices). A
+     * pixel brighter than one slice is only taken once, so the slices
+     * after it move on to the next lit pixels.
+     * @param validCount Lit pixels in the image (all are taken if
+     *        count reaches it)
+     * @param out Pixel indices, in raster order
+     * @return Pixels picked (count, unless the image ran out)
+     */
+    int _samplePixels(int totalPixels, int validCount, int count, uint16_t* out) {
+        uint64_t total = _brightnessSum[totalPixels - 1];
+        int picked = 0;
+        int i = 0;
+
+        if (count >= validCount) {
+            for (i = 0; i < totalPixels; i++) {
+                uint32_t before = i ? _brightnessSum[i - 1] : 0;
+                if (_brightnessSum[i] != before) out[picked++] = i;
+            }
+            return picked;
+        }
+
+        for (int j = 0; j < count && i < totalPixels; j++) {
+            uint32_t target = (uint32_t)(((2 * (uint64_t)j + 1) * total) / (2 * (uint64_t)count));
+            while (i < totalPixels && _brightnessSum[i] <= target) i++;
+
+            // Lit pixel i covers the target; take it if it's still free
+            if (picked > 0 && out[picked - 1] >= i) {
+                i = out[picked - 1] + 1;
+                while (i < totalPixels && _brightnessSum[i] == _brightnessSum[i - 1]) i++;
+            }
+            if (i < totalPixels) out[picked++] = i;
+        }
+        return picked;
+    }
+
+    /**
+     * Reorder the live particles for the Morton-sorted samples (the
+     * first sampleCount entries of _sortKeys/_sortIds): sample slot j
+     * receives the particle of the same rank along the curve, and
+     * sample slots left over are flagged SAMPLE_SPAWN. Particles left
+     * over move past the samples, in curve order.
+     * @return Particles moved onto a sample
+     */
+    int _assignParticles(int sampleCount) {
+        uint32_t* sampleKeys = _sortKeys;
+        uint32_t* keys = _sortKeys + MAX_PARTICLES;
+        uint16_t* ids = _sortIds + MAX_PARTICLES;
+        uint16_t* dest = _sortIds + 2 * MAX_PARTICLES;
+        int live = activeCount;
+        int slots = max(live, sampleCount);
+
+        for (int i = 0; i < live; i++) {
+            keys[i] = morton_key(FIXED_TO_INT(particles[i].x), FIXED_TO_INT(particles[i].y));
+            ids[i] = i;
+        }
+        morton_sort(keys, ids, live, _sortKeys + 2 * MAX_PARTICLES, dest);
+
+        // Pair by rank: the larger set is stepped through evenly, so
+        // every member of the smaller one gets a distinct partner
+        int spare = sampleCount;
+        if (live >= sampleCount) {
+            int k = 0;
+            for (int j = 0; j < sampleCount; j++) {
+                int pick = (int)((int64_t)j * live / sampleCount);
+                for (; k < pick; k++) dest[ids[k]] = spare++;
+                dest[ids[k++]] = j;
+            }
+            for (; k < live; k++) dest[ids[k]] = spare++;
+        } else {
+            int k = 0;
+            for (int j = 0; j < sampleCount; j++) {
+                if (k < live && (int)((int64_t)k * sampleCount / live) == j) {
+                    dest[ids[k++]] = j;
+                } else {
+                    // Unused slots past the live particles become
+                    // the new particles
+                    sampleKeys[j] |= SAMPLE_SPAWN;
+                    dest[live + (j - k)] = j;
+                }
+            }
+        }
+
+        // Apply the permutation in place, one cycle at a time
+        for (int i = 0; i < slots; i++) {
+            while (dest[i] != i) {
+                uint16_t d = dest[i];
+                Particle moved = particles[d];
+                particles[d] = particles[i];
+                particles[i] = moved;
+                dest[i] = dest[d];
+                dest[d] = d;
+            }
+        }
+
+        return min(live, sampleCount);
+    }
+
+    /**
+     * Advance physics by one step of dt seconds. Only per-step
+     * constants are computed in float; the particle loop is fixed-point
+     * with table trig and no divisions or roots.
+     */
+    void _step(float dt) {
         // Lerp config toward target
         _lerpConfig(dt);
 
@@ -314,11 +763,11 @@ public:
         globalRotation += config.rotation_speed * dt;
         if (globalRotation > 360.0f) globalRotation -= 360.0f;
 
-        pulsePhase += config.pulse_speed * dt;
-        if (pulsePhase > TWO_PI) pulsePhase -= TWO_PI;
+        // Radians per second -> binary angle step
+        pulsePhase += (uint16_t)FLOAT_TO_FIXED(config.pulse_speed * dt / TWO_PI);
 
-        float centerX = SCREEN_WIDTH / 2.0f;
-        float centerY = SCREEN_HEIGHT / 2.0f;
+        const fixed_t centerX = INT_TO_FIXED(SCREEN_WIDTH) / 2;
+        const fixed_t centerY = INT_TO_FIXED(SCREEN_HEIGHT) / 2;
 
         // Startup animation
         if (_startupActive) {
@@ -328,24 +777,47 @@ public:
             }
         }
 
+        // Per-step constants
+        const fixed_t fadeOutStep = FLOAT_TO_FIXED(FADE_OUT_SPEED * dt);
+        const fixed_t fadeInStep = FLOAT_TO_FIXED(2.0f * dt);
+        const fixed_t morphSpeed = FLOAT_TO_FIXED(POSITION_LERP_SPEED * dt);
+        const fixed_t radiusSpeed = FLOAT_TO_FIXED(2.0f * dt);
+        const fixed_t followSpeed = FLOAT_TO_FIXED(min(1.0f, 4.0f * dt));
+        const fixed_t angleStep = FLOAT_TO_FIXED(config.particle_speed * dt);
+        const fixed_t dispersion = FLOAT_TO_FIXED(config.dispersion);
+        const fixed_t opacityScale = FLOAT_TO_FIXED(config.opacity);
+        const fixed_t pushScale = FLOAT_TO_FIXED(config.dispersion * 0.3f);
+        const fixed_t sinPulse = fixed_sin(pulsePhase);
+
+        // pulse_outward wave: 0.02 rad per pixel from center
+        const fixed_t WAVE_PER_PIXEL = FLOAT_TO_FIXED(0.02f / TWO_PI);
+        const fixed_t DRIFT_RATE = FLOAT_TO_FIXED(0.3f);
+
+        // Global rotation, applied as one fixed rotation for all particles
+        bool rotate = abs(config.rotation_speed) > 0.01f;
+        fixed_t rotAngle = FLOAT_TO_FIXED(globalRotation / 360.0f);
+        fixed_t cosR = fixed_cos(rotAngle);
+        fixed_t sinR = fixed_sin(rotAngle);
+
         // Update each particle
         int effectiveCount = min(activeCount, config.particle_count);
 
         for (int i = 0; i < activeCount; i++) {
             Particle& p = particles[i];
+            p.prevX = p.x;
+            p.prevY = p.y;
 
             // Fade out particles beyond current count
             if (i >= effectiveCount) {
-                p.opacity = max(0.0f, p.opacity - FADE_OUT_SPEED * dt);
+                p.opacity = fixed_max(0, p.opacity - fadeOutStep);
                 continue;
             }
 
             // Handle morphing (new image transition)
             if (p.morphing) {
-                float morphSpeed = POSITION_LERP_SPEED * dt;
-                p.homeX += (p.targetHomeX - p.homeX) * morphSpeed;
-                p.homeY += (p.targetHomeY - p.homeY) * morphSpeed;
-                p.homeZ += (p.targetHomeZ - p.homeZ) * morphSpeed;
+                p.homeX += fixed_mul(p.targetHomeX - p.homeX, morphSpeed);
+                p.homeY += fixed_mul(p.targetHomeY - p.homeY, morphSpeed);
+                p.homeZ += fixed_mul(p.targetHomeZ - p.homeZ, morphSpeed);
 
                 // Morph color
                 p.r = _lerpByte(p.r, p.targetR, morphSpeed);
@@ -353,8 +825,8 @@ public:
                 p.b = _lerpByte(p.b, p.targetB, morphSpeed);
 
                 // Check if morph is complete
-                float dist = abs(p.homeX - p.targetHomeX) + abs(p.homeY - p.targetHomeY);
-                if (dist < 1.0f) {
+                fixed_t dist = fixed_abs(p.homeX - p.targetHomeX) + fixed_abs(p.homeY - p.targetHomeY);
+                if (dist < FIXED_ONE) {
                     p.homeX = p.targetHomeX;
                     p.homeY = p.targetHomeY;
                     p.homeZ = p.targetHomeZ;
@@ -363,202 +835,101 @@ public:
                     p.b = p.targetB;
                     p.morphing = false;
                 }
+                _updateHomeVector(p);
             }
 
             // Fade opacity
-            float targetOp = _clearing ? 0.0f : p.targetOpacity * config.opacity;
+            fixed_t targetOp = _clearing ? 0 : fixed_mul(p.targetOpacity, opacityScale);
             if (p.opacity < targetOp) {
-                p.opacity = min(targetOp, p.opacity + 2.0f * dt);
+                p.opacity = fixed_min(targetOp, p.opacity + fadeInStep);
             } else if (p.opacity > targetOp) {
-                p.opacity = max(targetOp, p.opacity - FADE_OUT_SPEED * dt);
+                p.opacity = fixed_max(targetOp, p.opacity - fadeOutStep);
             }
 
-            // Update orbit angles
-            p.angleXY += p.angularSpeedXY * config.particle_speed * dt;
-            p.angleXZ += p.angularSpeedXZ * config.particle_speed * dt;
+            // Update orbit angles (a 16.16 turn count is a binary angle)
+            fixed_t stepXY = fixed_mul(p.angularSpeedXY, angleStep);
+            fixed_t stepXZ = fixed_mul(p.angularSpeedXZ, angleStep);
+            p.angleXY += (uint16_t)stepXY;
+            p.angleXZ += (uint16_t)stepXZ;
+            p.driftXY += (uint16_t)fixed_mul(stepXY, DRIFT_RATE);
+            p.driftXZ += (uint16_t)fixed_mul(stepXZ, DRIFT_RATE);
 
             // Target orbit radius based on dispersion
-            float targetRadius = config.dispersion * (0.5f + 0.5f * sin(p.phase + pulsePhase));
-            p.orbitRadius += (targetRadius - p.orbitRadius) * 2.0f * dt;
+            fixed_t sinPhase = fixed_sin((uint16_t)(p.phase + pulsePhase));
+            fixed_t targetRadius = fixed_mul(dispersion, FIXED_HALF + (sinPhase >> 1));
+            p.orbitRadius += fixed_mul(targetRadius - p.orbitRadius, radiusSpeed);
 
             // Calculate position based on animation type
-            float animX = 0, animY = 0;
+            fixed_t animX = 0, animY = 0;
 
             switch (config.animation) {
                 case ANIM_FLOAT: {
                     // Gentle random drift around home
-                    animX = cos(p.angleXY) * p.orbitRadius;
-                    animY = sin(p.angleXZ) * p.orbitRadius;
+                    animX = fixed_mul(fixed_cos(p.angleXY), p.orbitRadius);
+                    animY = fixed_mul(fixed_sin(p.angleXZ), p.orbitRadius);
                     break;
                 }
 
                 case ANIM_DRIFT: {
                     // Very slow lazy movement
-                    animX = cos(p.angleXY * 0.3f) * p.orbitRadius * 0.5f;
-                    animY = sin(p.angleXZ * 0.3f) * p.orbitRadius * 0.5f;
+                    animX = fixed_mul(fixed_cos(p.driftXY), p.orbitRadius) >> 1;
+                    animY = fixed_mul(fixed_sin(p.driftXZ), p.orbitRadius) >> 1;
                     break;
                 }
 
                 case ANIM_SWIRL_INWARD: {
-                    // Orbit toward center (thinking)
-                    float dx = p.homeX - centerX;
-                    float dy = p.homeY - centerY;
-                    float dist = sqrtf(dx * dx + dy * dy) + 1.0f;
-                    float angle = atan2f(dy, dx) + p.angleXY;
+                    // Orbit toward center (thinking): home direction
+                    // rotated by angleXY, instead of atan2 + cos/sin
+                    fixed_t dx = p.homeX - centerX;
+                    fixed_t dy = p.homeY - centerY;
+                    fixed_t c = fixed_cos(p.angleXY);
+                    fixed_t s = fixed_sin(p.angleXY);
+                    fixed_t dirX = fixed_mul(p.homeDirX, c) - fixed_mul(p.homeDirY, s);
+                    fixed_t dirY = fixed_mul(p.homeDirY, c) + fixed_mul(p.homeDirX, s);
 
                     // Pull inward slightly
-                    float pullFactor = 0.7f + 0.3f * sin(pulsePhase + p.phase);
-                    animX = cos(angle) * p.orbitRadius * pullFactor - dx * 0.1f * sin(pulsePhase);
-                    animY = sin(angle) * p.orbitRadius * pullFactor - dy * 0.1f * sin(pulsePhase);
+                    fixed_t pullFactor = FLOAT_TO_FIXED(0.7f) + fixed_mul(FLOAT_TO_FIXED(0.3f), sinPhase);
+                    fixed_t orbit = fixed_mul(p.orbitRadius, pullFactor);
+                    animX = fixed_mul(dirX, orbit) - fixed_mul(fixed_mul(dx, FIXED_TENTH), sinPulse);
+                    animY = fixed_mul(dirY, orbit) - fixed_mul(fixed_mul(dy, FIXED_TENTH), sinPulse);
                     break;
                 }
 
                 case ANIM_PULSE_OUTWARD: {
                     // Push outward in waves from center (talking)
-                    float dx = p.homeX - centerX;
-                    float dy = p.homeY - centerY;
-                    float dist = sqrtf(dx * dx + dy * dy) + 1.0f;
-
-                    float pulseWave = sin(pulsePhase - dist * 0.02f);
-                    float pushAmount = pulseWave * config.dispersion * 0.3f;
+                    fixed_t wave = fixed_mul(p.homeDist + FIXED_ONE, WAVE_PER_PIXEL);
+                    fixed_t pulseWave = fixed_sin((uint16_t)(pulsePhase - wave));
+                    fixed_t pushAmount = fixed_mul(pulseWave, pushScale);
 
-                    animX = cos(p.angleXY) * p.orbitRadius + (dx / dist) * pushAmount;
-                    animY = sin(p.angleXZ) * p.orbitRadius + (dy / dist) * pushAmount;
+                    animX = fixed_mul(fixed_cos(p.angleXY), p.orbitRadius) + fixed_mul(p.homeDirX, pushAmount);
+                    animY = fixed_mul(fixed_sin(p.angleXZ), p.orbitRadius) + fixed_mul(p.homeDirY, pushAmount);
                     break;
                 }
             }
 
             // Apply global rotation
-            if (abs(config.rotation_speed) > 0.01f) {
-                float rad = globalRotation * DEG_TO_RAD;
-                float cosR = cos(rad);
-                float sinR = sin(rad);
-                float rx = animX * cosR - animY * sinR;
-                float ry = animX * sinR + animY * cosR;
+            if (rotate) {
+                fixed_t rx = fixed_mul(animX, cosR) - fixed_mul(animY, sinR);
+                fixed_t ry = fixed_mul(animX, sinR) + fixed_mul(animY, cosR);
                 animX = rx;
                 animY = ry;
             }
 
             // Lerp position toward target (smooth movement)
-            float targetX = p.homeX + animX;
-            float targetY = p.homeY + animY;
-            p.x += (targetX - p.x) * min(1.0f, 4.0f * dt);
-            p.y += (targetY - p.y) * min(1.0f, 4.0f * dt);
+            fixed_t targetX = p.homeX + animX;
+            fixed_t targetY = p.homeY + animY;
+            p.x += fixed_mul(targetX - p.x, followSpeed);
+            p.y += fixed_mul(targetY - p.y, followSpeed);
         }
 
         // Remove fully faded particles from the end
-        while (activeCount > 0 && particles[activeCount - 1].opacity < 0.01f
+        const fixed_t OPACITY_GONE = FLOAT_TO_FIXED(0.01f);
+        while (activeCount > 0 && particles[activeCount - 1].opacity < OPACITY_GONE
                && !particles[activeCount - 1].morphing) {
             activeCount--;
         }
     }
 
-    /**
-     * Render all particles to the display.
-     */
-    void render(Arduino_GFX* gfx) {
-        if (!particles || !gfx) return;
-
-        // Clear background
-        gfx->fillScreen(config.bg_color);
-
-        int effectiveCount = min(activeCount, (int)MAX_PARTICLES);
-        int size = max(1, (int)(config.particle_size + 0.5f));
-
-        for (int i = 0; i < effectiveCount; i++) {
-            Particle& p = particles[i];
-
-            if (p.opacity < 0.05f) continue;
-
-            // Screen bounds check
-            int sx = (int)(p.x + 0.5f);
-            int sy = (int)(p.y + 0.5f);
-
-            if (sx < -size || sx >= SCREEN_WIDTH + size ||
-                sy < -size || sy >= SCREEN_HEIGHT + size) {
-                continue;
-            }
-
-            // Apply opacity to color
-            uint8_t drawR = (uint8_t)(p.r * p.opacity);
-            uint8_t drawG = (uint8_t)(p.g * p.opacity);
-            uint8_t drawB = (uint8_t)(p.b * p.opacity);
-
-            uint16_t color = _rgb565(drawR, drawG, drawB);
-
-            // Draw based on shape
-            if (config.shape == SHAPE_CIRCLE) {
-                if (size <= 1) {
-                    gfx->drawPixel(sx, sy, color);
-                } else {
-                    gfx->fillCircle(sx, sy, size, color);
-                }
-            } else if (config.shape == SHAPE_SQUARE) {
-                gfx->fillRect(sx - size, sy - size, size * 2, size * 2, color);
-            }
-            // Star shape skipped for perf — circle is fastest
-        }
-
-        // Draw links between nearby particles (if enabled)
-        if (config.link_count > 0 && config.link_opacity > 0.01f) {
-            _renderLinks(gfx, effectiveCount);
-        }
-    }
-
-    /**
-     * Start clearing — fade all particles out.
-     */
-    void clear() {
-        _clearing = true;
-    }
-
-    /**
-     * Start the startup animation (particles emerge from center).
-     */
-    void startStartup() {
-        _startupActive = true;
-        _startupPhase = 0.0f;
-
-        // Create some initial particles at center
-        int count = min(DEFAULT_PARTICLE_COUNT, MAX_PARTICLES);
-        float centerX = SCREEN_WIDTH / 2.0f;
-        float centerY = SCREEN_HEIGHT / 2.0f;
-
-        for (int i = 0; i < count; i++) {
-            _initParticle(i,
-                centerX + random(-SCREEN_WIDTH / 3, SCREEN_WIDTH / 3),
-                centerY + random(-SCREEN_HEIGHT / 3, SCREEN_HEIGHT / 3),
-                0, 200 + random(55), 200 + random(55));  // Cyan-ish
-
-            // Start all at center
-            particles[i].x = centerX;
-            particles[i].y = centerY;
-            particles[i].opacity = 0.0f;
-            particles[i].targetOpacity = 0.8f;
-        }
-
-        activeCount = count;
-        _hasImage = false;
-    }
-
-    // Accessors
-    int getActiveCount() const { return activeCount; }
-    bool hasImage() const { return _hasImage; }
-    bool isClearing() const { return _clearing; }
-    const ParticleConfig& getConfig() const { return config; }
-
-private:
-    Particle* particles;
-    int activeCount;
-    ParticleConfig config;
-    ParticleConfig targetConfig;
-    float globalRotation;
-    float pulsePhase;
-    bool _clearing;
-    float _startupPhase;
-    bool _startupActive;
-    bool _hasImage;
-
     /**
      * Initialize a single particle.
      */
@@ -566,32 +937,70 @@ private:
         if (idx >= MAX_PARTICLES) return;
 
         Particle& p = particles[idx];
-        p.homeX = homeX;
-        p.homeY = homeY;
-        p.homeZ = 0.0f;
-        p.targetHomeX = homeX;
-        p.targetHomeY = homeY;
-        p.targetHomeZ = 0.0f;
-        p.x = homeX;
-        p.y = homeY;
-        p.z = 0.0f;
+        p.homeX = FLOAT_TO_FIXED(homeX);
+        p.homeY = FLOAT_TO_FIXED(homeY);
+        p.homeZ = 0;
+        p.targetHomeX = p.homeX;
+        p.targetHomeY = p.homeY;
+        p.targetHomeZ = 0;
+        p.x = p.homeX;
+        p.y = p.homeY;
+        p.z = 0;
+        p.prevX = p.x;
+        p.prevY = p.y;
         p.r = r;
         p.g = g;
         p.b = b;
         p.targetR = r;
         p.targetG = g;
         p.targetB = b;
-        p.opacity = 0.0f;
-        p.targetOpacity = 1.0f;
+        p.opacity = 0;
+        p.targetOpacity = FIXED_ONE;
         p.morphing = false;
+        _updateHomeVector(p);
+
+        // Random orbit parameters for variation (radians -> turns)
+        p.angleXY = _radiansToAngle(random(0, 628) / 100.0f);  // 0 to 2*PI
+        p.angleXZ = _radiansToAngle(random(0, 628) / 100.0f);
+        p.driftXY = (uint16_t)FLOAT_TO_FIXED(p.angleXY * 0.3f / 65536.0f);
+        p.driftXZ = (uint16_t)FLOAT_TO_FIXED(p.angleXZ * 0.3f / 65536.0f);
+        p.angularSpeedXY = FLOAT_TO_FIXED((0.5f + random(0, 100) / 100.0f) / TWO_PI);
+        p.angularSpeedXZ = FLOAT_TO_FIXED((0.3f + random(0, 100) / 150.0f) / TWO_PI);
+        p.orbitRadius = FLOAT_TO_FIXED(random(0, 100) / 100.0f * config.dispersion);
+        p.phase = _radiansToAngle(random(0, 628) / 100.0f);
+        p.srcX = -1;
+        p.srcY = -1;
+    }
+
+    /**
+     * Refresh the cached direction and distance from screen center
+     * to the particle's home (swirl and pulse animations).
+     */
+    static void _updateHomeVector(Particle& p) {
+        fixed_t dx = p.homeX - INT_TO_FIXED(SCREEN_WIDTH) / 2;
+        fixed_t dy = p.homeY - INT_TO_FIXED(SCREEN_HEIGHT) / 2;
+
+        // Square a quarter of the offset so it fits in 16.16
+        fixed_t qx = dx >> 2;
+        fixed_t qy = dy >> 2;
+        fixed_t dist = fixed_sqrt(fixed_mul(qx, qx) + fixed_mul(qy, qy)) << 2;
+
+        p.homeDist = dist;
+        if (dist > 0) {
+            p.homeDirX = fixed_div(dx, dist);
+            p.homeDirY = fixed_div(dy, dist);
+        } else {
+            // atan2(0, 0) = 0
+            p.homeDirX = FIXED_ONE;
+            p.homeDirY = 0;
+        }
+    }
 
-        // Random orbit parameters for variation
-        p.angleXY = random(0, 628) / 100.0f;  // 0 to 2*PI
-        p.angleXZ = random(0, 628) / 100.0f;
-        p.angularSpeedXY = 0.5f + random(0, 100) / 100.0f;
-        p.angularSpeedXZ = 0.3f + random(0, 100) / 150.0f;
-        p.orbitRadius = random(0, 100) / 100.0f * config.dispersion;
-        p.phase = random(0, 628) / 100.0f;
+    /**
+     * Convert radians to a binary angle (65536 = 2*PI).
+     */
+    static uint16_t _radiansToAngle(float rad) {
+        return (uint16_t)FLOAT_TO_FIXED(rad / TWO_PI);
     }
 
     /**
@@ -618,10 +1027,10 @@ private:
     }
 
     /**
-     * Lerp a byte value.
+     * Lerp a byte value (t in 16.16 fixed-point).
      */
-    static uint8_t _lerpByte(uint8_t a, uint8_t b, float t) {
-        return (uint8_t)(a + (int)(((int)b - (int)a) * t));
+    static uint8_t _lerpByte(uint8_t a, uint8_t b, fixed_t t) {
+        return (uint8_t)(a + ((((int)b - (int)a) * t) / FIXED_ONE));
     }
 
     /**
@@ -633,34 +1042,55 @@ private:
 
     /**
      * Render connecting lines between nearby particles.
-     * Limited to link_count lines for performance.
+     * Limited to link_count lines: sampled particles (spread evenly
+     * over the list) each link to their nearest later neighbor within
+     * range, found through a spatial grid, so links are stable from
+     * frame to frame.
      */
-    void _renderLinks(Arduino_GFX* gfx, int count) {
+    void _renderLinks(Framebuffer& fb, int count) {
         int linksDrawn = 0;
         int maxLinks = config.link_count;
-        float maxDist = config.dispersion * 2.0f;
-        float maxDistSq = maxDist * maxDist;
+        int maxDist = (int)(config.dispersion * 2.0f);
+        int maxDistSq = maxDist * maxDist;
 
         uint8_t linkAlpha = (uint8_t)(config.link_opacity * 255);
         uint16_t linkColor = _rgb565(linkAlpha / 4, linkAlpha / 2, linkAlpha / 2);
 
-        // Sample random pairs (don't check every combo — O(n²) is too slow)
-        for (int attempt = 0; attempt < maxLinks * 3 && linksDrawn < maxLinks; attempt++) {
-            int a = random(0, count);
-            int b = random(0, count);
-            if (a == b) continue;
-
-            float dx = particles[a].x - particles[b].x;
-            float dy = particles[a].y - particles[b].y;
-            float distSq = dx * dx + dy * dy;
-
-            if (distSq < maxDistSq && distSq > 4.0f) {
-                gfx->drawLine(
-                    (int)particles[a].x, (int)particles[a].y,
-                    (int)particles[b].x, (int)particles[b].y,
-                    linkColor
-                );
-                linksDrawn++;
+        // Bucket positions once per frame
+        _grid.clear();
+        for (int i = 0; i < count; i++) {
+            _grid.insert(i, particles[i].drawX, particles[i].drawY);
+        }
+        _grid.finalize();
+
+        fixed_t searchRadius = INT_TO_FIXED(maxDist);
+        int stride = max(1, count / max(1, maxLinks));
+
+        for (int offset = 0; offset < stride && linksDrawn < maxLinks; offset++) {
+            for (int a = offset; a < count && linksDrawn < maxLinks; a += stride) {
+                int ax = FIXED_TO_INT(particles[a].drawX);
+                int ay = FIXED_TO_INT(particles[a].drawY);
+                int nearest = -1;
+                int nearestSq = maxDistSq;
+
+                _grid.query(particles[a].drawX, particles[a].drawY, searchRadius, [&](uint16_t b) {
+                    if (b <= a) return;
+                    int dx = FIXED_TO_INT(particles[b].drawX) - ax;
+                    int dy = FIXED_TO_INT(particles[b].drawY) - ay;
+                    int distSq = dx * dx + dy * dy;
+                    if (distSq < nearestSq && distSq > 4) {
+                        nearest = b;
+                        nearestSq = distSq;
+                    }
+                });
+
+                if (nearest >= 0) {
+                    fb.drawLine(ax, ay,
+                                FIXED_TO_INT(particles[nearest].drawX),
+                                FIXED_TO_INT(particles[nearest].drawY),
+                                linkColor);
+                    linksDrawn++;
+                }
             }
         }
     }
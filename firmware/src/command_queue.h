@@ -0,0 +1,114 @@
+/**
+ * Ada Particles - Render Command Queue
+ *
+ * Typed commands from the network task to the render task.
+ * The network task owns the WebSocket and JSON parsing; the render
+ * task owns the ParticleSystem. They only meet here, through a
+ * lock-free single-producer/single-consumer ring, so a slow parse
+ * never stalls a frame and a slow frame never stalls the socket.
+ */
+
+#ifndef COMMAND_QUEUE_H
+#define COMMAND_QUEUE_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "../config.h"
+
+// ============================================
+// Command Types
+// ============================================
+
+// There is no image command: the sketch runs the native engine, which
+// draws no images, so binary frames are checked and dropped in the
+// network task (server_messages.cpp) and never cross this queue.
+enum CommandType : uint8_t {
+    CMD_SET_MOOD = 0,        // mood.valence, mood.arousal
+    CMD_SET_FORMATION,       // formation.type, formation.transitionMs
+    CMD_SET_PARTICLE_COUNT,  // particleCount
+    CMD_SET_DISCONNECTED,    // disconnected
+    CMD_SET_BRIGHTNESS       // brightness
+};
+
+struct Command {
+    CommandType type;
+
+    union {
+        struct {
+            float valence;
+            float arousal;
+        } mood;
+
+        struct {
+            uint8_t type;           // FormationType
+            uint16_t transitionMs;
+        } formation;
+
+        int particleCount;
+        bool disconnected;
+        uint8_t brightness;
+    };
+};
+
+// ============================================
+// SPSC Ring Buffer
+// ============================================
+
+/**
+ * Fixed-size single-producer/single-consumer queue.
+ * push() may only be called from one task and pop() from one other.
+ * Capacity must be a power of two; one slot is always left empty.
+ */
+template <size_t CAPACITY>
+class CommandQueue {
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+public:
+    CommandQueue() : _head(0), _tail(0) {}
+
+    /**
+     * Enqueue a command (producer side).
+     * @return false if the queue is full
+     */
+    bool push(const Command& cmd) {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        uint32_t next = (head + 1) & (CAPACITY - 1);
+
+        if (next == _tail.load(std::memory_order_acquire)) return false;
+
+        _slots[head] = cmd;
+        _head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Dequeue a command (consumer side).
+     * @return false if the queue is empty
+     */
+    bool pop(Command& cmd) {
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+
+        if (tail == _head.load(std::memory_order_acquire)) return false;
+
+        cmd = _slots[tail];
+        _tail.store((tail + 1) & (CAPACITY - 1), std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Check if empty (approximate when called from the producer).
+     */
+    bool isEmpty() const {
+        return _tail.load(std::memory_order_acquire) ==
+               _head.load(std::memory_order_acquire);
+    }
+
+private:
+    Command _slots[CAPACITY];
+
+    // Written by producer / consumer only
+    std::atomic<uint32_t> _head;
+    std::atomic<uint32_t> _tail;
+};
+
+#endif // COMMAND_QUEUE_H
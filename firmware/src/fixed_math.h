@@ -114,7 +114,7 @@ static inline fixed_t fixed_clamp(fixed_t x, fixed_t min_val, fixed_t max_val) {
 
 // Pre-computed sine table (quarter wave: 0 to 90 degrees)
 // Generated values: sin(i * PI/2 / 256) * 65536
-extern const int16_t SIN_TABLE[TRIG_TABLE_SIZE + 1];
+extern const int32_t SIN_TABLE[TRIG_TABLE_SIZE + 1];
 
 /**
  * Fast sine using lookup table.
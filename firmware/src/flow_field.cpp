@@ -0,0 +1,69 @@
+/**
+ * Ada Particles - Cached Curl Flow Field Implementation
+ */
+
+#include "flow_field.h"
+
+// Grid cells per screen pixel (16.16), and the largest grid coordinate
+// that still has a right/bottom neighbour to interpolate toward
+static const fixed_t TO_GRID_X = (fixed_t)(((int64_t)(FLOW_FIELD_SIZE - 1) << FIXED_SHIFT) / (SCREEN_WIDTH - 1));
+static const fixed_t TO_GRID_Y = (fixed_t)(((int64_t)(FLOW_FIELD_SIZE - 1) << FIXED_SHIFT) / (SCREEN_HEIGHT - 1));
+static const fixed_t GRID_MAX = INT_TO_FIXED(FLOW_FIELD_SIZE - 1) - 1;
+
+static_assert(FLOW_FIELD_SIZE >= 2, "flow field needs at least 2x2 nodes");
+
+FlowField::FlowField()
+    : _nextRow(0) {
+    memset(_nodes, 0, sizeof(_nodes));
+}
+
+void FlowField::refreshRow(int row, uint32_t t) {
+    // Same noise coordinates applyNoise() uses for a screen position
+    const uint32_t scale = (uint32_t)(NOISE_SCALE * 65536);
+    uint32_t py = (uint32_t)(row * (SCREEN_HEIGHT - 1) / (FLOW_FIELD_SIZE - 1)) << FIXED_SHIFT;
+    uint32_t sy = (uint64_t)py * scale >> 16;
+    
+    Node* node = &_nodes[row * FLOW_FIELD_SIZE];
+    for (int col = 0; col < FLOW_FIELD_SIZE; col++) {
+        uint32_t px = (uint32_t)(col * (SCREEN_WIDTH - 1) / (FLOW_FIELD_SIZE - 1)) << FIXED_SHIFT;
+        uint32_t sx = (uint64_t)px * scale >> 16;
+        curl_noise_2d(sx, sy, t, &node[col].vx, &node[col].vy);
+    }
+}
+
+void FlowField::fill(uint32_t t) {
+    for (int row = 0; row < FLOW_FIELD_SIZE; row++) {
+        refreshRow(row, t);
+    }
+    _nextRow = 0;
+}
+
+void FlowField::update(uint32_t t) {
+    for (int n = 0; n < FLOW_FIELD_ROWS_PER_FRAME; n++) {
+        refreshRow(_nextRow, t);
+        if (++_nextRow == FLOW_FIELD_SIZE) _nextRow = 0;
+    }
+}
+
+void FlowField::sample(fixed_t x, fixed_t y, fixed_t& outVX, fixed_t& outVY) const {
+    fixed_t gx = fixed_mul(x, TO_GRID_X);
+    fixed_t gy = fixed_mul(y, TO_GRID_Y);
+    gx = gx < 0 ? 0 : (gx > GRID_MAX ? GRID_MAX : gx);
+    gy = gy < 0 ? 0 : (gy > GRID_MAX ? GRID_MAX : gy);
+    
+    int col = FIXED_TO_INT(gx);
+    int row = FIXED_TO_INT(gy);
+    fixed_t fx = gx & (FIXED_ONE - 1);
+    fixed_t fy = gy & (FIXED_ONE - 1);
+    
+    const Node* n0 = &_nodes[row * FLOW_FIELD_SIZE + col];
+    const Node* n1 = n0 + FLOW_FIELD_SIZE;
+    
+    fixed_t topX = n0[0].vx + fixed_mul(n0[1].vx - n0[0].vx, fx);
+    fixed_t topY = n0[0].vy + fixed_mul(n0[1].vy - n0[0].vy, fx);
+    fixed_t botX = n1[0].vx + fixed_mul(n1[1].vx - n1[0].vx, fx);
+    fixed_t botY = n1[0].vy + fixed_mul(n1[1].vy - n1[0].vy, fx);
+    
+    outVX = topX + fixed_mul(botX - topX, fy);
+    outVY = topY + fixed_mul(botY - topY, fy);
+}
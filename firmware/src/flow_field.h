@@ -0,0 +1,55 @@
+/**
+ * Ada Particles - Cached Curl Flow Field
+ *
+ * Curl noise sampled on a coarse FLOW_FIELD_SIZE x FLOW_FIELD_SIZE
+ * grid of nodes spanning the screen. NOISE_SCALE makes the field vary
+ * over tens of pixels, so particles can bilinearly interpolate the
+ * grid instead of each evaluating the noise. The grid is refreshed a
+ * few rows per frame as noise time advances, which keeps the noise
+ * cost per frame fixed regardless of particle count.
+ */
+
+#ifndef FLOW_FIELD_H
+#define FLOW_FIELD_H
+
+#include <Arduino.h>
+#include "fixed_math.h"
+#include "noise.h"
+#include "../config.h"
+
+class FlowField {
+public:
+    FlowField();
+    
+    /**
+     * Evaluate every node at noise time t.
+     */
+    void fill(uint32_t t);
+    
+    /**
+     * Re-evaluate the next FLOW_FIELD_ROWS_PER_FRAME rows at time t,
+     * wrapping back to the top row after the last.
+     */
+    void update(uint32_t t);
+    
+    /**
+     * Bilinearly sample the field at a screen position.
+     * Positions off screen use the nearest edge.
+     * @param x, y Screen position (16.16 fixed-point)
+     */
+    void sample(fixed_t x, fixed_t y, fixed_t& outVX, fixed_t& outVY) const;
+
+private:
+    struct Node {
+        fixed_t vx;
+        fixed_t vy;
+    };
+    
+    Node _nodes[FLOW_FIELD_SIZE * FLOW_FIELD_SIZE];
+    int _nextRow;
+    
+    // Evaluate one row of nodes
+    void refreshRow(int row, uint32_t t);
+};
+
+#endif // FLOW_FIELD_H
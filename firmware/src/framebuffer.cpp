@@ -3,22 +3,48 @@
  */
 
 #include "framebuffer.h"
+#include "profiler.h"
+#include "memory_arena.h"
 
 // ============================================
 // Constructor / Destructor
 // ============================================
 
 Framebuffer::Framebuffer() 
-    : _buffer(nullptr), _gfx(nullptr), _spritesSet(false) {
+    : _buffer(nullptr), _front(nullptr), _staging(nullptr), _gfx(nullptr)
+    , _liveRows(_live[0]), _frontLive(_live[0])
+    , _bytesPushed(0), _pushTask(nullptr), _pushStart(nullptr), _pushDone(nullptr)
+    , _band(nullptr), _deferred(false), _pendingFade(0)
+    , _spritesSet(false), _lutColor(0), _lutValid(false) {
+#ifdef FB_INTENSITY_RENDER
+    _tint = FB_INTENSITY_DEFAULT_TINT;
+    _pushTint = 0;      // Matches the zeroed LUT, so the first push builds it
+    memset(_tintLut, 0, sizeof(_tintLut));
+#endif
+#ifdef FB_TILED_RENDER
+    _drawCount = 0;
+    _binCount = 0;
+#endif
     memset(_sprites, 0, sizeof(_sprites));
     memset(_spriteSizes, 0, sizeof(_spriteSizes));
+    memset(_spriteHalf, 0, sizeof(_spriteHalf));
+    memset(_spriteSpans, 0, sizeof(_spriteSpans));
+    memset(_dirtyRows, 0, sizeof(_dirtyRows));
+    memset(_live, 0, sizeof(_live));
+    memset(_pushDirty, 0, sizeof(_pushDirty));
+    initVisibleTiles();
 }
 
 Framebuffer::~Framebuffer() {
-    if (_buffer) {
-        free(_buffer);
-        _buffer = nullptr;
+    if (_pushTask) {
+        waitForPush();
+        vTaskDelete(_pushTask);
+        _pushTask = nullptr;
     }
+    if (_pushStart) vSemaphoreDelete(_pushStart);
+    if (_pushDone) vSemaphoreDelete(_pushDone);
+    
+    // The buffers are arena memory, held until reset
 }
 
 // ============================================
@@ -31,26 +57,194 @@ bool Framebuffer::init(Arduino_GFX* gfx) {
     // Allocate framebuffer in PSRAM
     size_t bufferBytes = FRAMEBUFFER_SIZE;
     
-    _buffer = (uint16_t*)ps_malloc(bufferBytes);
-    if (!_buffer) {
-        // Fallback to regular malloc (will likely fail for large buffer)
-        _buffer = (uint16_t*)malloc(bufferBytes);
-    }
-    
+    _buffer = (fb_pixel_t*)memoryArena.alloc(ARENA_FRAMEBUFFER, bufferBytes, ARENA_PSRAM);
     if (!_buffer) {
         Serial.println("ERROR: Failed to allocate framebuffer!");
         return false;
     }
     
     Serial.printf("Framebuffer allocated: %d bytes (%d x %d)\n", 
-                  bufferBytes, SCREEN_WIDTH, SCREEN_HEIGHT);
+                  bufferBytes, FB_WIDTH, FB_HEIGHT);
     
-    // Clear to black
-    clear(0x0000);
+    _front = _buffer;
+    
+    // Staging buffer for gathering one tile row of a partial window.
+    // Internal SRAM so the display driver reads it at full speed.
+    // Without it, windows are pushed one scanline at a time.
+    size_t stagingBytes = SCREEN_WIDTH * FB_TILE_SIZE * sizeof(uint16_t);
+    _staging = (uint16_t*)memoryArena.alloc(ARENA_FRAMEBUFFER, stagingBytes, ARENA_INTERNAL_ONLY);
+#ifdef FB_PUSH_CONVERTS
+    if (!_staging) {
+        // Pixels are converted into it on the way out
+        Serial.println("ERROR: Failed to allocate staging buffer!");
+        return false;
+    }
+#else
+    if (!_staging) {
+        Serial.println("WARNING: No staging buffer, pushing by scanline");
+    }
+#endif
+    
+#ifdef FB_TILED_RENDER
+    // Scratch band for tiled rendering (FB_TILE_SIZE rows)
+    size_t bandBytes = FB_WIDTH * FB_TILE_SIZE * sizeof(fb_pixel_t);
+    _band = (fb_pixel_t*)memoryArena.alloc(ARENA_FRAMEBUFFER, bandBytes, ARENA_INTERNAL_ONLY);
+    if (!_band) {
+        Serial.println("WARNING: No scratch band, rendering directly to PSRAM");
+    }
+#endif
+    
+#ifdef FRAMEBUFFER_ASYNC_PUSH
+    if (!startAsyncPush(bufferBytes)) {
+        Serial.println("WARNING: Async push unavailable, pushing synchronously");
+    }
+#endif
+    
+#ifdef FB_INTENSITY_RENDER
+    // The level LUT doesn't depend on the color: build it once
+    buildAlphaLut(0);
+    updateTint();
+#endif
+    
+    // Start black everywhere (the first fade reads the front buffer)
+    // and push one full frame to clear the panel
+    memset(_buffer, 0, bufferBytes);
+    if (isDoubleBuffered()) {
+        memset(_front, 0, bufferBytes);
+    }
+    markAllDirty();
     
     return true;
 }
 
+void Framebuffer::initVisibleTiles() {
+#ifdef DISPLAY_ROUND
+    // Doubled distance from the panel center to the nearest pixel
+    // center in [lo, hi] (doubling keeps it exact for even sizes)
+    auto nearest = [](int16_t lo, int16_t hi, int16_t size) -> int32_t {
+        int32_t a = 2 * lo + 1 - size;
+        int32_t b = 2 * hi + 1 - size;
+        if (a <= 0 && b >= 0) return 0;
+        return min(abs(a), abs(b));
+    };
+    
+    const int32_t diameter = min(SCREEN_WIDTH, SCREEN_HEIGHT);
+    
+    // Tiles are tested by the screen pixels they cover
+    const int16_t span = FB_TILE_SIZE << FB_RENDER_SHIFT;
+    
+    for (int16_t ty = 0; ty < FB_TILES_Y; ty++) {
+        int16_t y0 = ty * span;
+        int16_t y1 = min((int16_t)(y0 + span - 1), (int16_t)(SCREEN_HEIGHT - 1));
+        int32_t dy = nearest(y0, y1, SCREEN_HEIGHT);
+        
+        uint32_t mask = 0;
+        for (int16_t tx = 0; tx < FB_TILES_X; tx++) {
+            int16_t x0 = tx * span;
+            int16_t x1 = min((int16_t)(x0 + span - 1), (int16_t)(SCREEN_WIDTH - 1));
+            int32_t dx = nearest(x0, x1, SCREEN_WIDTH);
+            
+            if (dx * dx + dy * dy <= diameter * diameter) {
+                mask |= 1UL << tx;
+            }
+        }
+        _visibleRows[ty] = mask;
+    }
+#else
+    for (int16_t ty = 0; ty < FB_TILES_Y; ty++) {
+        _visibleRows[ty] = 0xFFFFFFFFUL >> (32 - FB_TILES_X);
+    }
+#endif
+}
+
+bool Framebuffer::startAsyncPush(size_t bufferBytes) {
+    _pushStart = xSemaphoreCreateBinary();
+    _pushDone = xSemaphoreCreateBinary();
+    
+    if (_pushStart && _pushDone) {
+        // Nothing in flight yet
+        xSemaphoreGive(_pushDone);
+        
+        // The task only touches the second buffer once a push is
+        // started, and arena memory can't be handed back: allocate
+        // it last, once nothing else can fail
+        if (xTaskCreatePinnedToCore(pushTaskEntry, "fb_push", DISPLAY_PUSH_STACK,
+                                    this, DISPLAY_PUSH_PRIORITY, &_pushTask,
+                                    DISPLAY_PUSH_CORE) == pdPASS) {
+            fb_pixel_t* second = (fb_pixel_t*)memoryArena.alloc(ARENA_FRAMEBUFFER, bufferBytes,
+                                                                ARENA_PSRAM);
+            if (second) {
+                _front = second;
+                _frontLive = _live[1];
+                Serial.printf("Async display push on core %d (+%d bytes)\n",
+                              DISPLAY_PUSH_CORE, bufferBytes);
+                return true;
+            }
+            vTaskDelete(_pushTask);
+        }
+        _pushTask = nullptr;
+    }
+    
+    if (_pushStart) vSemaphoreDelete(_pushStart);
+    if (_pushDone) vSemaphoreDelete(_pushDone);
+    _pushStart = nullptr;
+    _pushDone = nullptr;
+    return false;
+}
+
+// ============================================
+// Pixel Values
+// ============================================
+
+#ifdef FB_INTENSITY_RENDER
+
+// Level of an RGB565 color: its brightest channel, scaled so white is
+// (nearly) FB_INTENSITY_ONE
+static inline fb_pixel_t pixelFromColor(uint16_t c) {
+    uint8_t r = (c >> 10) & 0x3E;
+    uint8_t g = (c >> 5) & 0x3F;
+    uint8_t b = (c << 1) & 0x3E;
+    return max(r, max(g, b)) << 1;
+}
+
+static inline fb_pixel_t addPixel(fb_pixel_t a, fb_pixel_t b) {
+    uint16_t sum = (uint16_t)a + b;
+    return sum > 255 ? 255 : sum;
+}
+
+static inline fb_pixel_t scalePixel(fb_pixel_t c, uint8_t brightness) {
+    return (c * brightness) >> 8;
+}
+
+#else
+
+static inline fb_pixel_t pixelFromColor(uint16_t c) { return c; }
+
+// Saturating RGB565 add without unpacking. Each field's top bit is
+// masked off so the low bits add without carrying into the next field,
+// then the carry out of each field is rebuilt and widened into a
+// saturate mask. Matches per-channel min(max, a + b) for all inputs.
+static inline uint16_t addSat565(uint32_t a, uint32_t b) {
+    uint32_t sum = (a & 0x7BEF) + (b & 0x7BEF);
+    uint32_t carry = ((a & b) | ((a ^ b) & sum)) & 0x8410;
+    uint32_t sat = (carry << 1) - ((carry & 0x8010) >> 4) - ((carry & 0x400) >> 5);
+    return (sum ^ ((a ^ b) & 0x8410)) | sat;
+}
+
+static inline fb_pixel_t addPixel(fb_pixel_t a, fb_pixel_t b) {
+    return addSat565(a, b);
+}
+
+// Scale each channel by brightness (0-255)
+static inline fb_pixel_t scalePixel(fb_pixel_t c, uint8_t brightness) {
+    uint8_t r = (((c >> 11) & 0x1F) * brightness) >> 8;
+    uint8_t g = (((c >> 5) & 0x3F) * brightness) >> 8;
+    uint8_t b = ((c & 0x1F) * brightness) >> 8;
+    return (r << 11) | (g << 5) | b;
+}
+
+#endif // FB_INTENSITY_RENDER
+
 // ============================================
 // Clear / Fade
 // ============================================
@@ -58,8 +252,29 @@ bool Framebuffer::init(Arduino_GFX* gfx) {
 void Framebuffer::clear(uint16_t color) {
     if (!_buffer) return;
     
-    size_t pixels = SCREEN_WIDTH * SCREEN_HEIGHT;
+    // Anything still queued would be painted over anyway
+    _deferred = false;
+#ifdef FB_TILED_RENDER
+    _drawCount = 0;
+    _binCount = 0;
+#endif
+    
+    if (color == 0x0000) {
+        // Non-live tiles are already black. The panel changes only
+        // where the shown frame was lit (the front's live tiles).
+        for (int16_t ty = 0; ty < FB_TILES_Y; ty++) {
+            _dirtyRows[ty] |= _frontLive[ty];
+            zeroTiles(_buffer, ty, _liveRows[ty]);
+            _liveRows[ty] = 0;
+        }
+        return;
+    }
+    
+    size_t pixels = FB_WIDTH * FB_HEIGHT;
     
+#ifdef FB_INTENSITY_RENDER
+    memset(_buffer, pixelFromColor(color), pixels);
+#else
     // Fast clear using 32-bit writes
     uint32_t color32 = ((uint32_t)color << 16) | color;
     uint32_t* buf32 = (uint32_t*)_buffer;
@@ -73,6 +288,12 @@ void Framebuffer::clear(uint16_t color) {
     if (pixels & 1) {
         _buffer[pixels - 1] = color;
     }
+#endif
+    
+    for (int ty = 0; ty < FB_TILES_Y; ty++) {
+        _liveRows[ty] = color ? _visibleRows[ty] : 0;
+    }
+    markAllDirty();
 }
 
 void Framebuffer::fade(float factor) {
@@ -81,21 +302,89 @@ void Framebuffer::fade(float factor) {
     fadeFast(factor256);
 }
 
-void Framebuffer::fadeFast(uint8_t factor256) {
-    if (!_buffer) return;
+// Fade kernels: fade `pixels` values from src to dst and report
+// whether any were lit. When src == dst (in place), black spans are
+// left untouched; when copying, they are written as black.
+
+#if defined(FB_INTENSITY_RENDER)
+
+// One multiply per byte. Rows are not word-aligned (FB_WIDTH is not
+// a multiple of 4), so FADE_KERNEL_SWAR does not apply here.
+static inline bool fadeSpan(const fb_pixel_t* src, fb_pixel_t* dst, int16_t pixels,
+                            uint8_t factor256, bool copy) {
+    uint8_t lit = 0;
+    for (int16_t x = 0; x < pixels; x++) {
+        lit |= src[x];
+    }
     
-    size_t pixels = SCREEN_WIDTH * SCREEN_HEIGHT;
+    if (lit) {
+        for (int16_t x = 0; x < pixels; x++) {
+            dst[x] = (src[x] * factor256) >> 8;
+        }
+    } else if (copy) {
+        memset(dst, 0, pixels);
+    }
     
-    // Process in batches for cache efficiency
-    for (size_t i = 0; i < pixels; i++) {
-        uint16_t c = _buffer[i];
+    return lit != 0;
+}
+
+#elif defined(FADE_KERNEL_SWAR)
+
+// Two pixels per 32-bit word. Each channel is masked so the two
+// pixels' copies sit 16 bits apart; a channel times an 8-bit factor
+// needs at most 14 bits, so both lanes share one multiply without
+// carrying into each other. Result is identical to the scalar path.
+static inline uint32_t fade565x2(uint32_t w, uint32_t f) {
+    uint32_t r = ((((w >> 11) & 0x001F001F) * f) >> 8) & 0x001F001F;
+    uint32_t g = ((((w >> 5) & 0x003F003F) * f) >> 8) & 0x003F003F;
+    uint32_t b = (((w & 0x001F001F) * f) >> 8) & 0x001F001F;
+    return (r << 11) | (g << 5) | b;
+}
+
+static inline bool fadeSpan(const uint16_t* src, uint16_t* dst, int16_t pixels,
+                            uint8_t factor256, bool copy) {
+    const uint32_t* s = (const uint32_t*)src;
+    uint32_t* d = (uint32_t*)dst;
+    int16_t words = pixels >> 1;
+    
+    // One branch per span instead of one per pixel
+    uint32_t lit = 0;
+    for (int16_t i = 0; i < words; i++) {
+        lit |= s[i];
+    }
+    
+    if (lit) {
+        for (int16_t i = 0; i < words; i++) {
+            d[i] = fade565x2(s[i], factor256);
+        }
+    } else if (copy) {
+        for (int16_t i = 0; i < words; i++) {
+            d[i] = 0;
+        }
+    }
+    
+    return lit != 0;
+}
+
+#else
+
+static inline bool fadeSpan(const uint16_t* src, uint16_t* dst, int16_t pixels,
+                            uint8_t factor256, bool copy) {
+    uint16_t lit = 0;
+    
+    for (int16_t x = 0; x < pixels; x++) {
+        uint16_t c = src[x];
         
-        if (c == 0) continue;  // Skip pure black (common case)
+        if (c == 0) {  // Skip pure black (common case)
+            if (copy) dst[x] = 0;
+            continue;
+        }
+        lit |= c;
         
         // Extract RGB565 components
-        uint8_t r = rgb565_r(c);  // 5 bits (0-31)
-        uint8_t g = rgb565_g(c);  // 6 bits (0-63)
-        uint8_t b = rgb565_b(c);  // 5 bits (0-31)
+        uint8_t r = (c >> 11) & 0x1F;  // 5 bits (0-31)
+        uint8_t g = (c >> 5) & 0x3F;   // 6 bits (0-63)
+        uint8_t b = c & 0x1F;          // 5 bits (0-31)
         
         // Apply fade (integer multiply, then shift)
         // factor256 is 0-256, so multiply and shift by 8
@@ -103,7 +392,96 @@ void Framebuffer::fadeFast(uint8_t factor256) {
         g = (g * factor256) >> 8;
         b = (b * factor256) >> 8;
         
-        _buffer[i] = rgb565(r, g, b);
+        dst[x] = (r << 11) | (g << 5) | b;
+    }
+    
+    return lit != 0;
+}
+
+#endif // FB_INTENSITY_RENDER / FADE_KERNEL_SWAR
+
+void Framebuffer::zeroTiles(fb_pixel_t* buf, int16_t ty, uint32_t mask) {
+    int16_t y0 = ty << FB_TILE_SHIFT;
+    int16_t y1 = min((int16_t)(y0 + FB_TILE_SIZE), (int16_t)FB_HEIGHT);
+    
+    // One memset per row per run of tiles
+    while (mask) {
+        int first = __builtin_ctz(mask);
+        uint32_t rest = ~(mask >> first);
+        int run = rest ? __builtin_ctz(rest) : 32 - first;
+        mask &= ~((0xFFFFFFFFUL >> (32 - run)) << first);
+        
+        int16_t x = first << FB_TILE_SHIFT;
+        int16_t w = min((int16_t)(run << FB_TILE_SHIFT), (int16_t)(FB_WIDTH - x));
+        for (int16_t y = y0; y < y1; y++) {
+            memset(&buf[bufferIndex(x, y)], 0, w * sizeof(fb_pixel_t));
+        }
+    }
+}
+
+bool Framebuffer::fadeTile(const fb_pixel_t* src, fb_pixel_t* dst, int16_t tx, int16_t ty,
+                           uint8_t factor256, bool copy) {
+    int16_t x = tx << FB_TILE_SHIFT;
+    int16_t y0 = ty << FB_TILE_SHIFT;
+    int16_t y1 = min((int16_t)(y0 + FB_TILE_SIZE), (int16_t)FB_HEIGHT);
+    int16_t pixels = min((int16_t)FB_TILE_SIZE, (int16_t)(FB_WIDTH - x));
+    bool lit = false;
+    
+    for (int16_t y = y0; y < y1; y++) {
+        size_t idx = bufferIndex(x, y);
+        lit |= fadeSpan(&src[idx], &dst[idx], pixels, factor256, copy);
+    }
+    
+    return lit;
+}
+
+void Framebuffer::fadeFast(uint8_t factor256) {
+    if (!_buffer) return;
+    
+#ifdef FB_TILED_RENDER
+    if (_band) {
+        // Fade band by band in resolveTiles()
+        flush();
+        _pendingFade = factor256;
+        _deferred = true;
+        return;
+    }
+#endif
+    
+    PROFILE_SCOPE(PROFILE_FADE);
+    
+    // Double-buffered: fade the previous frame into the back buffer,
+    // so black pixels must be written too. Single: fade in place.
+    bool copy = isDoubleBuffered();
+    
+    // Only live tiles of the previous frame can hold a lit pixel.
+    // Each one that still does is marked dirty (fading always changes
+    // a non-black pixel) and live; the rest drop out of the live set.
+    for (int16_t ty = 0; ty < FB_TILES_Y; ty++) {
+        uint32_t mask = _frontLive[ty];
+        uint32_t lit = 0;
+        
+        while (mask) {
+            int tx = __builtin_ctz(mask);
+            mask &= mask - 1;
+            
+            if (fadeTile(_front, _buffer, tx, ty, factor256, copy)) {
+                lit |= 1UL << tx;
+            }
+        }
+        
+        if (copy) {
+            // Back tiles still holding a frame from two pushes ago,
+            // whose front copy has since gone black. The panel already
+            // shows black there, so clear them without marking dirty.
+            uint32_t stale = _liveRows[ty] & ~_frontLive[ty];
+            
+            zeroTiles(_buffer, ty, stale);
+        }
+        
+        _frontLive[ty] = lit;
+        _liveRows[ty] = lit;
+        _dirtyRows[ty] |= lit;
     }
 }
 
@@ -112,59 +490,43 @@ void Framebuffer::fadeFast(uint8_t factor256) {
 // ============================================
 
 void Framebuffer::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    flush();
+    x = toFb(x);
+    y = toFb(y);
     if (!_buffer || !inBounds(x, y)) return;
-    _buffer[bufferIndex(x, y)] = color;
+    _buffer[bufferIndex(x, y)] = pixelFromColor(color);
+    markPixelDirty(x, y);
 }
 
 void Framebuffer::drawPixelAdditive(int16_t x, int16_t y, uint16_t color) {
+    flush();
+    x = toFb(x);
+    y = toFb(y);
     if (!_buffer || !inBounds(x, y)) return;
     
-    size_t idx = bufferIndex(x, y);
-    uint16_t existing = _buffer[idx];
-    
-    // Extract channels
-    uint8_t er = rgb565_r(existing);
-    uint8_t eg = rgb565_g(existing);
-    uint8_t eb = rgb565_b(existing);
-    
-    uint8_t nr = rgb565_r(color);
-    uint8_t ng = rgb565_g(color);
-    uint8_t nb = rgb565_b(color);
-    
     // Add and clamp
-    uint8_t fr = min(31, er + nr);
-    uint8_t fg = min(63, eg + ng);
-    uint8_t fb = min(31, eb + nb);
-    
-    _buffer[idx] = rgb565(fr, fg, fb);
+    size_t idx = bufferIndex(x, y);
+    _buffer[idx] = addPixel(_buffer[idx], pixelFromColor(color));
+    markPixelDirty(x, y);
 }
 
 void Framebuffer::drawPixelAdditiveBright(int16_t x, int16_t y, 
                                           uint16_t color, uint8_t brightness) {
+    flush();
+    x = toFb(x);
+    y = toFb(y);
     if (!_buffer || !inBounds(x, y)) return;
     
+    // Scale new color by brightness, then add and clamp
     size_t idx = bufferIndex(x, y);
-    uint16_t existing = _buffer[idx];
-    
-    // Extract and scale new color by brightness
-    uint8_t nr = (rgb565_r(color) * brightness) >> 8;
-    uint8_t ng = (rgb565_g(color) * brightness) >> 8;
-    uint8_t nb = (rgb565_b(color) * brightness) >> 8;
-    
-    // Extract existing
-    uint8_t er = rgb565_r(existing);
-    uint8_t eg = rgb565_g(existing);
-    uint8_t eb = rgb565_b(existing);
-    
-    // Add and clamp
-    _buffer[idx] = rgb565(
-        min(31, er + nr),
-        min(63, eg + ng),
-        min(31, eb + nb)
-    );
+    _buffer[idx] = addPixel(_buffer[idx], scalePixel(pixelFromColor(color), brightness));
+    markPixelDirty(x, y);
 }
 
-uint16_t Framebuffer::getPixel(int16_t x, int16_t y) {
+fb_pixel_t Framebuffer::getPixel(int16_t x, int16_t y) {
+    flush();
+    x = toFb(x);
+    y = toFb(y);
     if (!_buffer || !inBounds(x, y)) return 0;
     return _buffer[bufferIndex(x, y)];
 }
@@ -174,19 +536,26 @@ uint16_t Framebuffer::getPixel(int16_t x, int16_t y) {
 // ============================================
 
 void Framebuffer::fillCircle(int16_t cx, int16_t cy, int16_t radius, uint16_t color) {
+    flush();
     if (!_buffer) return;
     
+    cx = toFb(cx);
+    cy = toFb(cy);
+    radius = toFb(radius);
+    markDirty(cx - radius, cy - radius, cx + radius, cy + radius);
+    
+    fb_pixel_t pixel = pixelFromColor(color);
     int16_t x = 0;
     int16_t y = radius;
     int16_t d = 3 - 2 * radius;
     
     auto drawHLine = [&](int16_t x1, int16_t x2, int16_t y) {
-        if (y < 0 || y >= SCREEN_HEIGHT) return;
+        if (y < 0 || y >= FB_HEIGHT) return;
         if (x1 > x2) { int16_t t = x1; x1 = x2; x2 = t; }
         x1 = max((int16_t)0, x1);
-        x2 = min((int16_t)(SCREEN_WIDTH - 1), x2);
+        x2 = min((int16_t)(FB_WIDTH - 1), x2);
         for (int16_t px = x1; px <= x2; px++) {
-            _buffer[bufferIndex(px, y)] = color;
+            _buffer[bufferIndex(px, y)] = pixel;
         }
     };
     
@@ -209,36 +578,30 @@ void Framebuffer::fillCircle(int16_t cx, int16_t cy, int16_t radius, uint16_t co
 
 void Framebuffer::fillCircleAdditive(int16_t cx, int16_t cy, int16_t radius,
                                      uint16_t color, uint8_t brightness) {
+    flush();
     if (!_buffer) return;
     
+    cx = toFb(cx);
+    cy = toFb(cy);
+    radius = toFb(radius);
+    markDirty(cx - radius, cy - radius, cx + radius, cy + radius);
+    
     // Pre-scale color by brightness
-    uint8_t nr = (rgb565_r(color) * brightness) >> 8;
-    uint8_t ng = (rgb565_g(color) * brightness) >> 8;
-    uint8_t nb = (rgb565_b(color) * brightness) >> 8;
+    fb_pixel_t add = scalePixel(pixelFromColor(color), brightness);
     
     int16_t x = 0;
     int16_t y = radius;
     int16_t d = 3 - 2 * radius;
     
     auto drawHLineAdd = [&](int16_t x1, int16_t x2, int16_t y) {
-        if (y < 0 || y >= SCREEN_HEIGHT) return;
+        if (y < 0 || y >= FB_HEIGHT) return;
         if (x1 > x2) { int16_t t = x1; x1 = x2; x2 = t; }
         x1 = max((int16_t)0, x1);
-        x2 = min((int16_t)(SCREEN_WIDTH - 1), x2);
+        x2 = min((int16_t)(FB_WIDTH - 1), x2);
         
         for (int16_t px = x1; px <= x2; px++) {
             size_t idx = bufferIndex(px, y);
-            uint16_t existing = _buffer[idx];
-            
-            uint8_t er = rgb565_r(existing);
-            uint8_t eg = rgb565_g(existing);
-            uint8_t eb = rgb565_b(existing);
-            
-            _buffer[idx] = rgb565(
-                min(31, er + nr),
-                min(63, eg + ng),
-                min(31, eb + nb)
-            );
+            _buffer[idx] = addPixel(_buffer[idx], add);
         }
     };
     
@@ -258,76 +621,575 @@ void Framebuffer::fillCircleAdditive(int16_t cx, int16_t cy, int16_t radius,
     }
 }
 
+// ============================================
+// Line Drawing
+// ============================================
+
+void Framebuffer::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    if (!_buffer) return;
+    flush();
+    
+    x0 = toFb(x0);
+    y0 = toFb(y0);
+    x1 = toFb(x1);
+    y1 = toFb(y1);
+    int16_t dx = abs(x1 - x0);
+    int16_t dy = -abs(y1 - y0);
+    int16_t stepX = (x0 < x1) ? 1 : -1;
+    int16_t stepY = (y0 < y1) ? 1 : -1;
+    int16_t err = dx + dy;
+    fb_pixel_t pixel = pixelFromColor(color);
+    
+    for (;;) {
+        if (inBounds(x0, y0)) {
+            _buffer[bufferIndex(x0, y0)] = pixel;
+            markPixelDirty(x0, y0);
+        }
+        if (x0 == x1 && y0 == y1) break;
+        
+        int16_t e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += stepX; }
+        if (e2 <= dx) { err += dx; y0 += stepY; }
+    }
+}
+
 // ============================================
 // Soft Particle Rendering
 // ============================================
 
-void Framebuffer::setParticleSprites(const uint8_t** sprites, const uint8_t* sizes) {
+void Framebuffer::setParticleSprites(const uint8_t** sprites, const uint8_t* sizes,
+                                     const SpriteSpan** spans) {
     for (int i = 0; i < 3; i++) {
         _sprites[i] = sprites[i];
-        _spriteSizes[i] = sizes[i];
+        _spriteSizes[i] = SPRITE_GRID(sizes[i]);
+        _spriteHalf[i] = sizes[i] / 2;
+        _spriteSpans[i] = spans[i];
     }
     _spritesSet = true;
 }
 
 void Framebuffer::drawSoftParticle(int16_t cx, int16_t cy, uint8_t spriteIdx,
-                                   uint16_t color, uint8_t brightness) {
+                                   uint16_t color, uint8_t brightness, uint8_t phase) {
     if (!_buffer || !_spritesSet) return;
     if (spriteIdx >= 3) spriteIdx = 2;
+    if (phase >= SPRITE_PHASES) phase = 0;
+    
+    if (!_sprites[spriteIdx] || !_spriteSpans[spriteIdx]) return;
+    
+#if FB_RENDER_SHIFT > 0
+    // Position in sub-pixel steps, scaled down: the screen bits the
+    // framebuffer drops become part of the sprite phase
+    const int32_t phaseMask = SPRITE_SUBPIXEL_STEPS - 1;
+    int32_t qx = ((int32_t)cx * SPRITE_SUBPIXEL_STEPS + (phase & phaseMask)) >> FB_RENDER_SHIFT;
+    int32_t qy = ((int32_t)cy * SPRITE_SUBPIXEL_STEPS + (phase >> SPRITE_SUBPIXEL_SHIFT)) >> FB_RENDER_SHIFT;
+    cx = qx >> SPRITE_SUBPIXEL_SHIFT;
+    cy = qy >> SPRITE_SUBPIXEL_SHIFT;
+    phase = ((qy & phaseMask) << SPRITE_SUBPIXEL_SHIFT) | (qx & phaseMask);
+#endif
     
-    const uint8_t* sprite = _sprites[spriteIdx];
     uint8_t size = _spriteSizes[spriteIdx];
-    int16_t halfSize = size / 2;
+    int16_t left = cx - _spriteHalf[spriteIdx];
+    int16_t top = cy - _spriteHalf[spriteIdx];
     
-    if (!sprite) return;
+#ifdef FB_TILED_RENDER
+    if (_deferred) {
+        // Queue it for resolveTiles() unless the lists are full
+        int16_t ty0 = max((int16_t)0, top) >> FB_TILE_SHIFT;
+        int16_t ty1 = min((int16_t)(FB_HEIGHT - 1), (int16_t)(top + size - 1)) >> FB_TILE_SHIFT;
+        if (ty0 > ty1) return;  // Entirely above or below the screen
+        
+        uint16_t rows = ty1 - ty0 + 1;
+        if (_drawCount < FB_DRAW_LIST_SIZE && _binCount + rows <= BIN_CAPACITY) {
+            DrawItem& item = _drawList[_drawCount++];
+            item.cx = cx;
+            item.cy = cy;
+            item.color = color;
+            item.spriteIdx = spriteIdx;
+            item.brightness = brightness;
+            item.phase = phase;
+            _binCount += rows;
+            return;
+        }
+        flush();
+    }
+#endif
     
-    // Pre-calculate color components
+    markDirty(left, top, left + size - 1, top + size - 1);
+    blendSoftParticle(_buffer, 0, FB_HEIGHT, cx, cy, spriteIdx, phase, color, brightness);
+}
+
+// Blend n sprite texels into a row. One multiply per texel remains
+// (alpha x brightness); the color multiplies live in the LUT, and a
+// zero alpha adds LUT[0] == 0, so no per-texel branches are needed.
+static inline void blendSpriteRow(fb_pixel_t* dst, const uint8_t* alpha, int16_t n,
+                                  const fb_pixel_t* lut, uint8_t brightness) {
+    for (int16_t i = 0; i < n; i++) {
+        uint8_t combined = ((uint16_t)alpha[i] * brightness) >> 8;
+        dst[i] = addPixel(dst[i], lut[combined]);
+    }
+}
+
+#ifdef FB_INTENSITY_RENDER
+
+// Blend n texels at a given level (the color only sets the level)
+static inline void blendSpriteRowColor(fb_pixel_t* dst, const uint8_t* alpha, int16_t n,
+                                       fb_pixel_t level, uint8_t brightness) {
+    for (int16_t i = 0; i < n; i++) {
+        uint8_t combined = ((uint16_t)alpha[i] * brightness) >> 8;
+        dst[i] = addPixel(dst[i], (combined * level) >> 8);
+    }
+}
+
+#else
+
+// Blend n texels of a per-particle color. The color is spread into
+// 0x07E0F81F lanes so one multiply by a 5-bit alpha scales all three
+// channels at once (5 bits of headroom per lane), then folded back.
+static inline void blendSpriteRowColor(uint16_t* dst, const uint8_t* alpha, int16_t n,
+                                       uint32_t spread, uint8_t brightness) {
+    for (int16_t i = 0; i < n; i++) {
+        uint32_t a5 = ((uint16_t)alpha[i] * brightness) >> 11;
+        uint32_t c = ((spread * a5) >> 5) & 0x07E0F81F;
+        dst[i] = addSat565(dst[i], (uint16_t)(c | (c >> 16)));
+    }
+}
+
+#endif // FB_INTENSITY_RENDER
+
+// Fully on-screen sprite: no clipping, loop bounds known at compile
+// time, and only each row's covered span is visited
+template <uint8_t SIZE>
+static void blitSprite(fb_pixel_t* dst, const uint8_t* sprite, const SpriteSpan* spans,
+                       const fb_pixel_t* lut, uint8_t brightness) {
+    for (uint8_t sy = 0; sy < SIZE; sy++) {
+        SpriteSpan span = spans[sy];
+        blendSpriteRow(dst + span.start, sprite + span.start, span.length, lut, brightness);
+        dst += FB_WIDTH;
+        sprite += SIZE;
+    }
+}
+
+void Framebuffer::buildAlphaLut(uint16_t color) {
+#ifdef FB_INTENSITY_RENDER
+    // Full alpha adds one particle's worth of intensity
+    for (int a = 0; a < 256; a++) {
+        _alphaLut[a] = (a * FB_INTENSITY_ONE) >> 8;
+    }
+#else
     uint8_t baseR = rgb565_r(color);
     uint8_t baseG = rgb565_g(color);
     uint8_t baseB = rgb565_b(color);
     
-    // Iterate over sprite pixels
-    for (int16_t sy = 0; sy < size; sy++) {
-        int16_t screenY = cy - halfSize + sy;
-        if (screenY < 0 || screenY >= SCREEN_HEIGHT) continue;
+    for (int a = 0; a < 256; a++) {
+        _alphaLut[a] = rgb565((baseR * a) >> 8, (baseG * a) >> 8, (baseB * a) >> 8);
+    }
+#endif
+    
+    _lutColor = color;
+    _lutValid = true;
+}
+
+void Framebuffer::blendSoftParticle(fb_pixel_t* dst, int16_t y0, int16_t y1,
+                                    int16_t cx, int16_t cy, uint8_t spriteIdx, uint8_t phase,
+                                    uint16_t color, uint8_t brightness) {
+#ifndef FB_INTENSITY_RENDER
+    // Particles share one color per frame, so this rarely rebuilds
+    if (!_lutValid || color != _lutColor) buildAlphaLut(color);
+#else
+    (void)color;    // One level for every particle
+#endif
+    
+    uint8_t size = _spriteSizes[spriteIdx];
+    const uint8_t* sprite = _sprites[spriteIdx] + phase * size * size;
+    const SpriteSpan* spans = _spriteSpans[spriteIdx] + phase * size;
+    int16_t left = cx - _spriteHalf[spriteIdx];
+    int16_t top = cy - _spriteHalf[spriteIdx];
+    
+    if (left >= 0 && left + size <= FB_WIDTH && top >= y0 && top + size <= y1) {
+        fb_pixel_t* origin = &dst[(size_t)(top - y0) * FB_WIDTH + left];
         
-        for (int16_t sx = 0; sx < size; sx++) {
-            int16_t screenX = cx - halfSize + sx;
-            if (screenX < 0 || screenX >= SCREEN_WIDTH) continue;
-            
-            // Get sprite alpha value
-            uint8_t alpha = sprite[sy * size + sx];
-            if (alpha == 0) continue;
-            
-            // Combine alpha with brightness
-            uint16_t combinedAlpha = ((uint16_t)alpha * brightness) >> 8;
-            if (combinedAlpha == 0) continue;
+        switch (size) {
+            case SPRITE_GRID(SPRITE_DIAMETER(PARTICLE_SIZE_SMALL)):
+                blitSprite<SPRITE_GRID(SPRITE_DIAMETER(PARTICLE_SIZE_SMALL))>(origin, sprite, spans, _alphaLut, brightness);
+                return;
+            case SPRITE_GRID(SPRITE_DIAMETER(PARTICLE_SIZE_MEDIUM)):
+                blitSprite<SPRITE_GRID(SPRITE_DIAMETER(PARTICLE_SIZE_MEDIUM))>(origin, sprite, spans, _alphaLut, brightness);
+                return;
+            case SPRITE_GRID(SPRITE_DIAMETER(PARTICLE_SIZE_LARGE)):
+                blitSprite<SPRITE_GRID(SPRITE_DIAMETER(PARTICLE_SIZE_LARGE))>(origin, sprite, spans, _alphaLut, brightness);
+                return;
+            default:
+                break;
+        }
+    }
+    
+    // Clipped (or unusual size): clip each span to the visible window
+    int16_t sx0 = max(0, -left);
+    int16_t sx1 = min((int16_t)size, (int16_t)(FB_WIDTH - left));
+    int16_t sy0 = max(0, y0 - top);
+    int16_t sy1 = min((int16_t)size, (int16_t)(y1 - top));
+    
+    for (int16_t sy = sy0; sy < sy1; sy++) {
+        int16_t start = max((int16_t)spans[sy].start, sx0);
+        int16_t end = min((int16_t)(spans[sy].start + spans[sy].length), sx1);
+        if (start >= end) continue;
+        
+        fb_pixel_t* row = &dst[(size_t)(top + sy - y0) * FB_WIDTH + left + start];
+        blendSpriteRow(row, &sprite[sy * size + start], end - start, _alphaLut, brightness);
+    }
+}
+
+void Framebuffer::drawSprite(int16_t left, int16_t top, const SpriteRef& sprite,
+                             uint16_t color, uint8_t brightness) {
+    if (!_buffer || !sprite.alpha || !sprite.spans) return;
+    flush();
+    
+    left = toFb(left);
+    top = toFb(top);
+    uint8_t size = sprite.size;
+    markDirty(left, top, left + size - 1, top + size - 1);
+    
+#ifdef FB_INTENSITY_RENDER
+    fb_pixel_t spread = pixelFromColor(color);
+#else
+    uint32_t spread = (color | ((uint32_t)color << 16)) & 0x07E0F81F;
+#endif
+    
+    // Clip each span to the screen
+    int16_t sx0 = max(0, -left);
+    int16_t sx1 = min((int16_t)size, (int16_t)(FB_WIDTH - left));
+    int16_t sy0 = max(0, -top);
+    int16_t sy1 = min((int16_t)size, (int16_t)(FB_HEIGHT - top));
+    
+    for (int16_t sy = sy0; sy < sy1; sy++) {
+        int16_t start = max((int16_t)sprite.spans[sy].start, sx0);
+        int16_t end = min((int16_t)(sprite.spans[sy].start + sprite.spans[sy].length), sx1);
+        if (start >= end) continue;
+        
+        blendSpriteRowColor(&_buffer[bufferIndex(left + start, top + sy)],
+                            &sprite.alpha[sy * size + start], end - start, spread, brightness);
+    }
+}
+
+// ============================================
+// Tiled Rendering
+// ============================================
+
+void Framebuffer::resolveTiles() {
+    _deferred = false;
+    
+#ifdef FB_TILED_RENDER
+    PROFILE_START(t);
+    bool copy = isDoubleBuffered();
+    
+    // Bin queued draws by every tile row they overlap (counting sort).
+    // Saturating additive blends commute, so draw order is free.
+    uint16_t cursor[FB_TILES_Y];
+    memset(_binStart, 0, sizeof(_binStart));
+    
+    for (uint16_t i = 0; i < _drawCount; i++) {
+        const DrawItem& item = _drawList[i];
+        uint8_t size = _spriteSizes[item.spriteIdx];
+        int16_t top = item.cy - _spriteHalf[item.spriteIdx];
+        int16_t ty0 = max((int16_t)0, top) >> FB_TILE_SHIFT;
+        int16_t ty1 = min((int16_t)(FB_HEIGHT - 1), (int16_t)(top + size - 1)) >> FB_TILE_SHIFT;
+        for (int16_t ty = ty0; ty <= ty1; ty++) {
+            _binStart[ty + 1]++;
+        }
+    }
+    for (int16_t ty = 0; ty < FB_TILES_Y; ty++) {
+        _binStart[ty + 1] += _binStart[ty];
+        cursor[ty] = _binStart[ty];
+    }
+    for (uint16_t i = 0; i < _drawCount; i++) {
+        const DrawItem& item = _drawList[i];
+        uint8_t size = _spriteSizes[item.spriteIdx];
+        int16_t top = item.cy - _spriteHalf[item.spriteIdx];
+        int16_t ty0 = max((int16_t)0, top) >> FB_TILE_SHIFT;
+        int16_t ty1 = min((int16_t)(FB_HEIGHT - 1), (int16_t)(top + size - 1)) >> FB_TILE_SHIFT;
+        for (int16_t ty = ty0; ty <= ty1; ty++) {
+            _binItems[cursor[ty]++] = i;
+        }
+    }
+    PROFILE_LAP(PROFILE_RASTER, t);
+    
+    for (int16_t ty = 0; ty < FB_TILES_Y; ty++) {
+        int16_t y0 = ty << FB_TILE_SHIFT;
+        int16_t y1 = min((int16_t)(y0 + FB_TILE_SIZE), (int16_t)FB_HEIGHT);
+        
+        // Tiles this band's draws touch (off-panel tiles are dropped)
+        uint32_t touched = 0;
+        for (uint16_t b = _binStart[ty]; b < _binStart[ty + 1]; b++) {
+            const DrawItem& item = _drawList[_binItems[b]];
+            uint8_t size = _spriteSizes[item.spriteIdx];
+            int16_t left = item.cx - _spriteHalf[item.spriteIdx];
+            int16_t x0 = max((int16_t)0, left);
+            int16_t x1 = min((int16_t)(FB_WIDTH - 1), (int16_t)(left + size - 1));
+            if (x0 > x1) continue;
+            int16_t tx0 = x0 >> FB_TILE_SHIFT;
+            int16_t tx1 = x1 >> FB_TILE_SHIFT;
+            touched |= (0xFFFFFFFFUL >> (31 - tx1)) & (0xFFFFFFFFUL << tx0);
+        }
+        touched &= _visibleRows[ty];
+        
+        // Bring every tile we will write back into the band: faded
+        // from the front if live there, otherwise black (which also
+        // clears stale back-buffer tiles when double-buffered)
+        uint32_t frontLive = _frontLive[ty];
+        uint32_t staged = frontLive | touched | (copy ? _liveRows[ty] : 0);
+        if (!staged) continue;
+        
+        uint32_t lit = 0;
+        uint32_t mask = staged;
+        while (mask) {
+            int tx = __builtin_ctz(mask);
+            mask &= mask - 1;
             
-            // Calculate final color contribution
-            uint8_t nr = (baseR * combinedAlpha) >> 8;
-            uint8_t ng = (baseG * combinedAlpha) >> 8;
-            uint8_t nb = (baseB * combinedAlpha) >> 8;
+            int16_t x = tx << FB_TILE_SHIFT;
+            int16_t w = min((int16_t)FB_TILE_SIZE, (int16_t)(FB_WIDTH - x));
             
-            // Additive blend to framebuffer
-            size_t idx = bufferIndex(screenX, screenY);
-            uint16_t existing = _buffer[idx];
+            for (int16_t y = y0; y < y1; y++) {
+                fb_pixel_t* dst = &_band[(size_t)(y - y0) * FB_WIDTH + x];
+                if (frontLive & (1UL << tx)) {
+                    if (fadeSpan(&_front[bufferIndex(x, y)], dst, w, _pendingFade, true)) {
+                        lit |= 1UL << tx;
+                    }
+                } else {
+                    memset(dst, 0, w * sizeof(fb_pixel_t));
+                }
+            }
+        }
+        PROFILE_LAP(PROFILE_FADE, t);
+        
+        // Composite this band's particles in SRAM
+        for (uint16_t b = _binStart[ty]; b < _binStart[ty + 1]; b++) {
+            const DrawItem& item = _drawList[_binItems[b]];
+            blendSoftParticle(_band, y0, y1, item.cx, item.cy, item.spriteIdx, item.phase,
+                              item.color, item.brightness);
+        }
+        
+        // Write back one burst per row per run of staged tiles
+        mask = staged;
+        while (mask) {
+            int first = __builtin_ctz(mask);
+            uint32_t rest = ~(mask >> first);
+            int run = rest ? __builtin_ctz(rest) : 32 - first;
+            mask &= ~((0xFFFFFFFFUL >> (32 - run)) << first);
             
-            _buffer[idx] = rgb565(
-                min(31, (int)rgb565_r(existing) + nr),
-                min(63, (int)rgb565_g(existing) + ng),
-                min(31, (int)rgb565_b(existing) + nb)
-            );
+            int16_t x = first << FB_TILE_SHIFT;
+            int16_t w = min((int16_t)(run << FB_TILE_SHIFT), (int16_t)(FB_WIDTH - x));
+            for (int16_t y = y0; y < y1; y++) {
+                memcpy(&_buffer[bufferIndex(x, y)], &_band[(size_t)(y - y0) * FB_WIDTH + x],
+                       w * sizeof(fb_pixel_t));
+            }
         }
+        PROFILE_LAP(PROFILE_RASTER, t);
+        
+        // Same bookkeeping as fadeFast(), plus the drawn tiles
+        _frontLive[ty] = lit;
+        _liveRows[ty] = lit | touched;
+        _dirtyRows[ty] |= lit | touched;
     }
+    
+    _drawCount = 0;
+    _binCount = 0;
+#endif
 }
 
 // ============================================
 // Display Output
 // ============================================
 
+void Framebuffer::markDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    x0 = max((int16_t)0, x0);
+    y0 = max((int16_t)0, y0);
+    x1 = min((int16_t)(FB_WIDTH - 1), x1);
+    y1 = min((int16_t)(FB_HEIGHT - 1), y1);
+    if (x0 > x1 || y0 > y1) return;
+    
+    // Bits tx0..tx1 inclusive
+    int16_t tx0 = x0 >> FB_TILE_SHIFT;
+    int16_t tx1 = x1 >> FB_TILE_SHIFT;
+    uint32_t mask = (0xFFFFFFFFUL >> (31 - tx1)) & (0xFFFFFFFFUL << tx0);
+    
+    for (int16_t ty = y0 >> FB_TILE_SHIFT; ty <= (y1 >> FB_TILE_SHIFT); ty++) {
+        uint32_t bits = mask & _visibleRows[ty];
+        _dirtyRows[ty] |= bits;
+        _liveRows[ty] |= bits;
+    }
+}
+
+void Framebuffer::markAllDirty() {
+    for (int ty = 0; ty < FB_TILES_Y; ty++) {
+        _dirtyRows[ty] = _visibleRows[ty];
+    }
+}
+
+uint16_t Framebuffer::getLiveTiles() const {
+    uint16_t count = 0;
+    for (int ty = 0; ty < FB_TILES_Y; ty++) {
+        count += __builtin_popcount(_liveRows[ty]);
+    }
+    return count;
+}
+
 void Framebuffer::pushToDisplay() {
     if (!_buffer || !_gfx) return;
     
-    // Use efficient bitmap draw function
-    _gfx->draw16bitRGBBitmap(0, 0, _buffer, SCREEN_WIDTH, SCREEN_HEIGHT);
+    flush();
+    
+    // Fade and raster work resolved by flush() is timed there
+    PROFILE_SCOPE(PROFILE_PUSH);
+    
+    if (!isDoubleBuffered()) {
+#ifdef FB_INTENSITY_RENDER
+        updateTint();
+#endif
+        _bytesPushed = pushDirtyTiles(_buffer, _dirtyRows);
+        return;
+    }
+    
+    // Wait for the previous frame to leave, then hand this one over
+    xSemaphoreTake(_pushDone, portMAX_DELAY);
+    
+#ifdef FB_INTENSITY_RENDER
+    // The push task is idle, so its LUT can change now
+    updateTint();
+#endif
+    
+    memcpy(_pushDirty, _dirtyRows, sizeof(_dirtyRows));
+    memset(_dirtyRows, 0, sizeof(_dirtyRows));
+    
+    fb_pixel_t* finished = _buffer;
+    _buffer = _front;
+    _front = finished;
+    
+    uint32_t* finishedLive = _liveRows;
+    _liveRows = _frontLive;
+    _frontLive = finishedLive;
+    
+    xSemaphoreGive(_pushStart);
+}
+
+void Framebuffer::waitForPush() {
+    if (!isDoubleBuffered()) return;
+    
+    xSemaphoreTake(_pushDone, portMAX_DELAY);
+    xSemaphoreGive(_pushDone);
+}
+
+#ifdef FB_INTENSITY_RENDER
+void Framebuffer::updateTint() {
+    if (_tint == _pushTint) return;
+    
+    uint8_t r = rgb565_r(_tint);
+    uint8_t g = rgb565_g(_tint);
+    uint8_t b = rgb565_b(_tint);
+    
+    // Above FB_INTENSITY_ONE each channel saturates on its own, as
+    // overlapping RGB565 blends do
+    for (int i = 0; i < 256; i++) {
+        _tintLut[i] = rgb565(min(31, (r * i) / FB_INTENSITY_ONE),
+                             min(63, (g * i) / FB_INTENSITY_ONE),
+                             min(31, (b * i) / FB_INTENSITY_ONE));
+    }
+    _pushTint = _tint;
+    
+    // Every lit pixel of the frame changes color
+    for (int ty = 0; ty < FB_TILES_Y; ty++) {
+        _dirtyRows[ty] |= _liveRows[ty];
+    }
+}
+#endif
+
+void Framebuffer::pushTaskEntry(void* arg) {
+    Framebuffer* fb = (Framebuffer*)arg;
+    
+    for (;;) {
+        xSemaphoreTake(fb->_pushStart, portMAX_DELAY);
+        fb->_bytesPushed = fb->pushDirtyTiles(fb->_front, fb->_pushDirty);
+        xSemaphoreGive(fb->_pushDone);
+    }
+}
+
+uint32_t Framebuffer::pushDirtyTiles(const fb_pixel_t* src, uint32_t* dirtyRows) {
+    uint32_t bytes = 0;
+    
+    for (int ty = 0; ty < FB_TILES_Y; ty++) {
+        uint32_t mask = dirtyRows[ty];
+        dirtyRows[ty] = 0;
+        
+        int16_t y = ty << FB_TILE_SHIFT;
+        int16_t h = min((int16_t)FB_TILE_SIZE, (int16_t)(FB_HEIGHT - y));
+        
+        // One window per run of consecutive dirty tiles
+        while (mask) {
+            int first = __builtin_ctz(mask);
+            uint32_t rest = ~(mask >> first);
+            int run = rest ? __builtin_ctz(rest) : 32 - first;
+            mask &= ~((0xFFFFFFFFUL >> (32 - run)) << first);
+            
+            int16_t x = first << FB_TILE_SHIFT;
+            int16_t w = min((int16_t)(run << FB_TILE_SHIFT), (int16_t)(FB_WIDTH - x));
+            pushRect(src, x, y, w, h);
+            bytes += ((uint32_t)w * h * sizeof(uint16_t)) << (2 * FB_RENDER_SHIFT);
+        }
+    }
+    
+    return bytes;
+}
+
+void Framebuffer::pushRect(const fb_pixel_t* src, int16_t x, int16_t y, int16_t w, int16_t h) {
+#ifdef FB_PUSH_CONVERTS
+    // Convert the window into the staging block (SCREEN_WIDTH x
+    // FB_TILE_SIZE): colorize in intensity mode, and repeat each pixel
+    // and scanline to upscale. Output past the screen edge is clipped.
+    const int16_t scale = 1 << FB_RENDER_SHIFT;
+    const int16_t chunk = FB_TILE_SIZE >> FB_RENDER_SHIFT;
+    int16_t outX = x * scale;
+    int16_t outW = min((int16_t)(w * scale), (int16_t)(SCREEN_WIDTH - outX));
+    
+    for (int16_t row0 = 0; row0 < h; row0 += chunk) {
+        int16_t rows = min(chunk, (int16_t)(h - row0));
+        int16_t outY = (y + row0) * scale;
+        int16_t outH = min((int16_t)(rows * scale), (int16_t)(SCREEN_HEIGHT - outY));
+        uint16_t* out = _staging;
+        
+        for (int16_t row = 0; row < rows; row++) {
+            const fb_pixel_t* in = &src[bufferIndex(x, y + row0 + row)];
+            for (int16_t i = 0; i < outW; i++) {
+#ifdef FB_INTENSITY_RENDER
+                out[i] = _tintLut[in[i >> FB_RENDER_SHIFT]];
+#else
+                out[i] = in[i >> FB_RENDER_SHIFT];
+#endif
+            }
+            for (int16_t k = 1; k < scale; k++) {
+                memcpy(&out[k * outW], out, outW * sizeof(uint16_t));
+            }
+            out += outW * scale;
+        }
+        
+        _gfx->draw16bitRGBBitmap(outX, outY, _staging, outW, outH);
+    }
+#else
+    // Arduino_GFX takes a non-const bitmap but only reads it
+    uint16_t* pixels = (uint16_t*)src;
+    
+    if (w == FB_WIDTH) {
+        // Full-width rows are already contiguous
+        _gfx->draw16bitRGBBitmap(x, y, &pixels[bufferIndex(x, y)], w, h);
+    } else if (_staging) {
+        // Gather the window into one linear block
+        for (int16_t row = 0; row < h; row++) {
+            memcpy(&_staging[row * w], &pixels[bufferIndex(x, y + row)],
+                   w * sizeof(uint16_t));
+        }
+        _gfx->draw16bitRGBBitmap(x, y, _staging, w, h);
+    } else {
+        for (int16_t row = 0; row < h; row++) {
+            _gfx->draw16bitRGBBitmap(x, y + row, &pixels[bufferIndex(x, y + row)], w, 1);
+        }
+    }
+#endif
 }
@@ -4,6 +4,38 @@
  * PSRAM-backed framebuffer for double-buffering and smooth trails.
  * Instead of clearing to black each frame, we fade the existing
  * content, creating dreamy particle trails.
+ * 
+ * Every write marks the 16x16 tiles it touches as dirty, and
+ * pushToDisplay() only sends the dirty tiles to the panel.
+ * 
+ * Each buffer also keeps a "live" bitmap of tiles that may hold a
+ * non-black pixel. fade() only visits live tiles, and a tile drops
+ * out once its fade has converged to black. Tiles entirely outside
+ * the round panel are never marked live or dirty, so they are
+ * neither faded nor pushed.
+ * 
+ * With FB_TILED_RENDER, fade() and drawSoftParticle() are deferred:
+ * draws are binned per tile row, and at push time each band is faded
+ * from PSRAM into an internal-SRAM scratch band, composited there and
+ * written back in row bursts. Any other access flushes the pending
+ * work first, so callers see the same result in either mode.
+ * 
+ * With FRAMEBUFFER_ASYNC_PUSH, a second buffer is kept: a task on
+ * DISPLAY_PUSH_CORE streams the finished (front) frame while the next
+ * frame is faded from it into the back buffer and drawn there.
+ * Every frame must start with fade() or clear() in this mode.
+ * 
+ * With FB_INTENSITY_RENDER, a pixel is one 8-bit intensity instead of
+ * RGB565 (half the memory), so fades and blends are byte operations.
+ * Draw colors only set the level; the whole frame takes the tint
+ * (setTint()) through a 256-entry LUT as it is pushed.
+ * 
+ * With FB_RENDER_SHIFT, the buffers (and tiles) are FB_WIDTH x
+ * FB_HEIGHT: fades and blends touch a quarter of the pixels at shift
+ * 1. Drawing still takes screen coordinates, scaled on entry (only
+ * markDirty() and getBuffer() work in framebuffer pixels), and each
+ * pixel is sent as a square of screen pixels by repeating it and its
+ * scanline in the staging block.
  */
 
 #ifndef FRAMEBUFFER_H
@@ -11,7 +43,33 @@
 
 #include <Arduino.h>
 #include <Arduino_GFX_Library.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
 #include "../config.h"
+#include "sprites.h"
+
+#if FB_TILES_X > 32
+#error "FB_TILES_X must fit in one 32-bit dirty mask per tile row"
+#endif
+
+#ifdef FB_INTENSITY_RENDER
+// Intensity: FB_INTENSITY_ONE is one full-brightness particle, the
+// range above it is headroom where overlaps saturate toward white
+typedef uint8_t fb_pixel_t;
+#define FB_INTENSITY_ONE 128
+#else
+typedef uint16_t fb_pixel_t;    // RGB565
+#endif
+
+// Pushes that convert pixels (colorize or upscale) go through staging
+#if defined(FB_INTENSITY_RENDER) || FB_RENDER_SHIFT > 0 || FB_WIDTH != SCREEN_WIDTH
+#define FB_PUSH_CONVERTS
+#endif
+
+#if defined(FADE_KERNEL_SWAR) && (FB_WIDTH & 1)
+#error "FADE_KERNEL_SWAR needs an even FB_WIDTH (word-aligned rows)"
+#endif
 
 // ============================================
 // Framebuffer Class
@@ -31,6 +89,8 @@ public:
     
     /**
      * Clear framebuffer to solid color.
+     * Clearing to black only touches live tiles, so engines that
+     * redraw from scratch each frame still push just what changed.
      * @param color RGB565 color (default: black)
      */
     void clear(uint16_t color = 0x0000);
@@ -38,7 +98,8 @@ public:
     /**
      * Fade framebuffer toward black.
      * Each pixel's RGB channels are multiplied by factor.
-     * This creates the trail effect.
+     * This creates the trail effect (when double-buffered, the
+     * previous frame is faded into the back buffer).
      * 
      * @param factor Fade factor 0.0-1.0 (0.92 = retain 92%)
      */
@@ -46,6 +107,7 @@ public:
     
     /**
      * Fast fade using integer math.
+     * Uses the two-pixels-per-word kernel with FADE_KERNEL_SWAR.
      * @param factor256 Fade factor 0-256 (236 ≈ 0.92)
      */
     void fadeFast(uint8_t factor256);
@@ -102,32 +164,109 @@ public:
      * @param spriteIdx Which pre-rendered sprite to use (0-2)
      * @param color RGB565 base color
      * @param brightness 0-255 brightness
+     * @param phase Sub-pixel phase variant (see spritePhase())
      */
     void drawSoftParticle(int16_t cx, int16_t cy, uint8_t spriteIdx,
-                          uint16_t color, uint8_t brightness);
+                          uint16_t color, uint8_t brightness, uint8_t phase = 0);
+    
+    /**
+     * Draw a sprite in any color with additive blending.
+     * For engines with per-particle colors (the soft particle path
+     * is faster when every particle shares one color).
+     * 
+     * @param left Left edge of the sprite on screen
+     * @param top Top edge of the sprite on screen
+     * @param sprite Alpha map and row spans
+     * @param color RGB565 color at full alpha
+     * @param brightness 0-255 brightness
+     */
+    void drawSprite(int16_t left, int16_t top, const SpriteRef& sprite,
+                    uint16_t color, uint8_t brightness);
+    
+    /**
+     * Draw a line (Bresenham, overwrites pixels).
+     */
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
     
     /**
      * Set pointer to particle sprites for soft rendering.
      * @param sprites Array of 3 sprite pointers (small, medium, large)
-     * @param sizes Array of sprite diameters
+     * @param sizes Array of sprite diameters (stored on SPRITE_GRID)
+     * @param spans Array of per-row span tables (one per sprite)
      */
-    void setParticleSprites(const uint8_t** sprites, const uint8_t* sizes);
+    void setParticleSprites(const uint8_t** sprites, const uint8_t* sizes,
+                            const SpriteSpan** spans);
     
+#ifdef FB_INTENSITY_RENDER
     /**
-     * Push framebuffer to display.
-     * Uses efficient block transfer.
+     * Set the color that FB_INTENSITY_ONE is shown as
+     * (FB_INTENSITY_DEFAULT_TINT until the first call).
+     * Takes effect for the whole frame at the next push; a change
+     * re-sends every lit tile.
+     * @param color RGB565 color
+     */
+    void setTint(uint16_t color) { _tint = color; }
+#endif
+    
+    /**
+     * Push dirty regions of the framebuffer to display.
+     * Each tile row is sent as one address window per run of
+     * consecutive dirty tiles, then the dirty set is cleared.
+     * 
+     * When double-buffered this only waits for the previous frame's
+     * transfer, swaps buffers and hands the new front to the push task.
      */
     void pushToDisplay();
     
+    /**
+     * Run deferred fade and particle draws (tiled mode).
+     * Called by pushToDisplay() and any direct access; a no-op when
+     * nothing is pending.
+     */
+    inline void flush() { if (_deferred) resolveTiles(); }
+    
+    /**
+     * Block until no frame transfer is in flight.
+     * Call before touching the display bus from elsewhere.
+     */
+    void waitForPush();
+    
+    /**
+     * True when frames are pushed asynchronously from a second buffer.
+     */
+    bool isDoubleBuffered() const { return _front != _buffer; }
+    
+    /**
+     * Mark a rectangle as changed (for writes through getBuffer()).
+     * Coordinates are framebuffer pixels, inclusive and clipped to
+     * the buffer; the tiles become dirty and live.
+     */
+    void markDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+    
+    /**
+     * Mark the whole (visible) screen as changed.
+     */
+    void markAllDirty();
+    
+    /**
+     * Bytes sent to the display by the last completed push.
+     */
+    uint32_t getBytesPushed() const { return _bytesPushed; }
+    
+    /**
+     * Number of live tiles in the draw buffer.
+     */
+    uint16_t getLiveTiles() const;
+    
     /**
      * Get direct access to buffer (for advanced rendering).
      */
-    uint16_t* getBuffer() { return _buffer; }
+    fb_pixel_t* getBuffer() { flush(); return _buffer; }
     
     /**
-     * Get pixel at coordinates.
+     * Get pixel at coordinates (RGB565, or intensity).
      */
-    uint16_t getPixel(int16_t x, int16_t y);
+    fb_pixel_t getPixel(int16_t x, int16_t y);
     
     // Accessors
     int16_t width() const { return SCREEN_WIDTH; }
@@ -135,22 +274,132 @@ public:
     bool isValid() const { return _buffer != nullptr; }
 
 private:
-    uint16_t* _buffer;          // RGB565 framebuffer in PSRAM
+    fb_pixel_t* _buffer;        // Framebuffer in PSRAM (draw target)
+    fb_pixel_t* _front;         // Last finished frame (== _buffer if single)
+    uint16_t* _staging;         // One tile row, internal SRAM (push gather)
     Arduino_GFX* _gfx;          // Display pointer
     
+    // Dirty tiles: one bit per tile column, one word per tile row
+    uint32_t _dirtyRows[FB_TILES_Y];
+    
+    // Live tiles (same layout) of the draw and front buffers. Point
+    // at the same storage when single-buffered; swapped with buffers.
+    uint32_t _live[2][FB_TILES_Y];
+    uint32_t* _liveRows;
+    uint32_t* _frontLive;
+    
+    // Tiles that overlap the round panel
+    uint32_t _visibleRows[FB_TILES_Y];
+    volatile uint32_t _bytesPushed;
+    
+    // Async push (front buffer + its dirty set belong to the task)
+    uint32_t _pushDirty[FB_TILES_Y];
+    TaskHandle_t _pushTask;
+    SemaphoreHandle_t _pushStart;
+    SemaphoreHandle_t _pushDone;
+    
+    // Tiled render: SRAM scratch band and this frame's deferred work
+    fb_pixel_t* _band;          // FB_TILE_SIZE rows, internal SRAM
+    bool _deferred;             // Fade/draws queued, buffer not current
+    uint8_t _pendingFade;
+    
+#ifdef FB_TILED_RENDER
+    struct DrawItem {
+        int16_t cx;
+        int16_t cy;
+        uint16_t color;
+        uint8_t spriteIdx;
+        uint8_t brightness;
+        uint8_t phase;
+    };
+    
+    // A sprite (<= 2 tiles tall) overlaps at most 3 tile rows
+    static const uint16_t BIN_CAPACITY = FB_DRAW_LIST_SIZE * 3;
+    
+    DrawItem _drawList[FB_DRAW_LIST_SIZE];
+    uint16_t _drawCount;
+    uint16_t _binCount;                 // Sum of tile rows over items
+    uint16_t _binStart[FB_TILES_Y + 1]; // Per tile row, into _binItems
+    uint16_t _binItems[BIN_CAPACITY];
+#endif
+    
     // Particle sprite pointers
     const uint8_t* _sprites[3];
-    uint8_t _spriteSizes[3];
+    uint8_t _spriteSizes[3];    // Grid width of every phase
+    uint8_t _spriteHalf[3];     // Center offset (diameter / 2)
+    const SpriteSpan* _spriteSpans[3];
     bool _spritesSet;
     
+    // Premultiplied contribution of _lutColor per combined alpha
+    fb_pixel_t _alphaLut[256];
+    uint16_t _lutColor;
+    bool _lutValid;
+    
+#ifdef FB_INTENSITY_RENDER
+    // Tint to show, and the RGB565 of each intensity for the frame
+    // being pushed (only rebuilt between pushes)
+    uint16_t _tint;
+    uint16_t _pushTint;
+    uint16_t _tintLut[256];
+#endif
+    
+    // Helper: Screen coordinate to framebuffer pixel
+    static inline int16_t toFb(int16_t v) { return v >> FB_RENDER_SHIFT; }
+    
     // Helper: Check bounds
     inline bool inBounds(int16_t x, int16_t y) const {
-        return x >= 0 && x < SCREEN_WIDTH && y >= 0 && y < SCREEN_HEIGHT;
+        return x >= 0 && x < FB_WIDTH && y >= 0 && y < FB_HEIGHT;
     }
     
+    // Helper: Mark the tile containing a pixel (must be in bounds)
+    inline void markPixelDirty(int16_t x, int16_t y) {
+        int16_t ty = y >> FB_TILE_SHIFT;
+        uint32_t bit = (1UL << (x >> FB_TILE_SHIFT)) & _visibleRows[ty];
+        _dirtyRows[ty] |= bit;
+        _liveRows[ty] |= bit;
+    }
+    
+    // Helper: Additive sprite blend into rows [y0, y1) of dst,
+    // where dst points at row y0 of a FB_WIDTH-stride buffer
+    // (framebuffer coordinates and phase)
+    void blendSoftParticle(fb_pixel_t* dst, int16_t y0, int16_t y1,
+                           int16_t cx, int16_t cy, uint8_t spriteIdx, uint8_t phase,
+                           uint16_t color, uint8_t brightness);
+    
+    // Helper: Rebuild _alphaLut for a particle color
+    void buildAlphaLut(uint16_t color);
+    
+    // Helper: Fade, composite and write back every band (tiled mode)
+    void resolveTiles();
+    
+    // Helper: Zero the tiles in one tile row's mask
+    void zeroTiles(fb_pixel_t* buf, int16_t ty, uint32_t mask);
+    
+    // Helper: Build _visibleRows from the panel circle
+    void initVisibleTiles();
+    
+    // Helper: Fade one tile from src into dst, return true if lit
+    bool fadeTile(const fb_pixel_t* src, fb_pixel_t* dst, int16_t tx, int16_t ty,
+                  uint8_t factor256, bool copy);
+    
+    // Helper: Push every dirty tile run of a buffer, clearing the mask
+    uint32_t pushDirtyTiles(const fb_pixel_t* src, uint32_t* dirtyRows);
+    
+    // Helper: Push one window of a buffer
+    void pushRect(const fb_pixel_t* src, int16_t x, int16_t y, int16_t w, int16_t h);
+    
+#ifdef FB_INTENSITY_RENDER
+    // Helper: Rebuild _tintLut for the tint, marking lit tiles dirty
+    void updateTint();
+#endif
+    
+    // Helper: Start the push task and second buffer
+    bool startAsyncPush(size_t bufferBytes);
+    static void pushTaskEntry(void* arg);
+    
     // Helper: Get buffer index
     inline size_t bufferIndex(int16_t x, int16_t y) const {
-        return (size_t)y * SCREEN_WIDTH + x;
+        return (size_t)y * FB_WIDTH + x;
     }
     
     // Helper: RGB565 channel extraction
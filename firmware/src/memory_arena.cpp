@@ -0,0 +1,185 @@
+/**
+ * Ada Particles - Boot-Time Memory Arena Implementation
+ */
+
+#include "memory_arena.h"
+#include "framebuffer.h"
+#include "particle.h"
+#include "sprites.h"
+#include <esp_heap_caps.h>
+
+// Global instance
+MemoryArena memoryArena;
+
+// ============================================
+// Budget Table
+// ============================================
+
+// Internal SRAM and PSRAM per subsystem, in bytes. Each term is one
+// allocation, rounded to MEMORY_ALIGN as alloc() rounds it.
+struct ArenaBudget {
+    const char* name;
+    size_t bytes[ARENA_REGION_COUNT];
+};
+
+#define SPRITE_SIZES_BYTES(kind) \
+    (MEMORY_ROUND(kind(SPRITE_DIAMETER(PARTICLE_SIZE_SMALL))) + \
+     MEMORY_ROUND(kind(SPRITE_DIAMETER(PARTICLE_SIZE_MEDIUM))) + \
+     MEMORY_ROUND(kind(SPRITE_DIAMETER(PARTICLE_SIZE_LARGE))))
+
+#ifdef FB_TILED_RENDER
+#define FB_BAND_BYTES MEMORY_ROUND(FB_WIDTH * FB_TILE_SIZE * sizeof(fb_pixel_t))
+#else
+#define FB_BAND_BYTES 0
+#endif
+
+#ifdef FRAMEBUFFER_ASYNC_PUSH
+#define FB_BUFFER_COUNT 2
+#else
+#define FB_BUFFER_COUNT 1
+#endif
+
+static const ArenaBudget BUDGETS[ARENA_OWNER_COUNT] = {
+    // Staging row + tile band; draw and push buffers
+    { "framebuffer", { MEMORY_ROUND(SCREEN_WIDTH * FB_TILE_SIZE * sizeof(uint16_t)) + FB_BAND_BYTES,
+                       FB_BUFFER_COUNT * MEMORY_ROUND(FRAMEBUFFER_SIZE) } },
+    
+    // Hot arrays; cold arrays
+    { "particles", { MEMORY_ROUND(MAX_PARTICLES * PARTICLE_HOT_BYTES),
+                     MEMORY_ROUND(MAX_PARTICLES * PARTICLE_COLD_BYTES) } },
+    
+    // Spans; alpha maps, unless they are baked into flash
+    { "sprites", { SPRITE_SIZES_BYTES(SPRITE_SPAN_BYTES),
+                   spriteTablesMatch() ? 0 : SPRITE_SIZES_BYTES(SPRITE_ALPHA_BYTES) } },
+    
+    // Only in image engine builds, which replace the native engine
+    // above: not reserved, tracked on the heap
+    { "image", { 0, 0 } },
+
+#ifdef MESSAGE_LOG
+    { "message_log", { 0, MEMORY_ROUND(MESSAGE_LOG_SIZE) } },
+#else
+    { "message_log", { 0, 0 } },
+#endif
+};
+
+static const char* const REGION_NAMES[ARENA_REGION_COUNT] = { "SRAM", "PSRAM" };
+
+static const uint32_t REGION_CAPS[ARENA_REGION_COUNT] = {
+    MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA | MALLOC_CAP_8BIT,
+    MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT
+};
+
+// ============================================
+// Arena
+// ============================================
+
+MemoryArena::MemoryArena() : _reserved(false) {
+    memset(_base, 0, sizeof(_base));
+    memset(_start, 0, sizeof(_start));
+    memset(_used, 0, sizeof(_used));
+    memset(_heap, 0, sizeof(_heap));
+}
+
+bool MemoryArena::init() {
+    if (_reserved) return _base[0] && _base[1];
+    _reserved = true;
+    
+    bool ok = true;
+    for (uint8_t region = 0; region < ARENA_REGION_COUNT; region++) {
+        // Slices back to back, in table order
+        size_t total = 0;
+        for (uint8_t owner = 0; owner < ARENA_OWNER_COUNT; owner++) {
+            _start[owner][region] = total;
+            total += BUDGETS[owner].bytes[region];
+        }
+        if (total == 0) continue;
+        
+        _base[region] = (uint8_t*)heap_caps_aligned_alloc(MEMORY_ALIGN, total, REGION_CAPS[region]);
+        if (!_base[region]) {
+            Serial.printf("WARNING: Cannot reserve %u bytes of %s, allocating from the heap\n",
+                          (unsigned)total, REGION_NAMES[region]);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+void* MemoryArena::take(ArenaOwner owner, uint8_t region, size_t bytes) {
+    if (_base[region] && _used[owner][region] + bytes <= BUDGETS[owner].bytes[region]) {
+        void* p = _base[region] + _start[owner][region] + _used[owner][region];
+        _used[owner][region] += bytes;
+        return p;
+    }
+    return fromHeap(owner, region, bytes);
+}
+
+void* MemoryArena::fromHeap(ArenaOwner owner, uint8_t region, size_t bytes) {
+    void* p = heap_caps_aligned_alloc(MEMORY_ALIGN, bytes, REGION_CAPS[region]);
+    if (p) {
+        _heap[owner][region] += bytes;
+        if (BUDGETS[owner].bytes[region] > 0) {
+            Serial.printf("WARNING: %s over its %s budget by %u bytes\n", BUDGETS[owner].name,
+                          REGION_NAMES[region], (unsigned)_heap[owner][region]);
+        }
+    }
+    return p;
+}
+
+void* MemoryArena::alloc(ArenaOwner owner, size_t bytes, ArenaPlacement placement) {
+    init();
+    
+    bytes = MEMORY_ROUND(bytes ? bytes : 1);
+    uint8_t first = (placement == ARENA_PSRAM) ? ARENA_REGION_PSRAM : ARENA_REGION_INTERNAL;
+    
+    void* p = take(owner, first, bytes);
+    if (!p && placement != ARENA_INTERNAL_ONLY) {
+        p = take(owner, first ^ 1, bytes);
+    }
+    return p;
+}
+
+size_t MemoryArena::getBudget(ArenaOwner owner, ArenaRegion region) const {
+    return BUDGETS[owner].bytes[region];
+}
+
+size_t MemoryArena::getOverflow() const {
+    size_t total = 0;
+    for (uint8_t owner = 0; owner < ARENA_OWNER_COUNT; owner++) {
+        if (BUDGETS[owner].bytes[0] > 0) total += _heap[owner][0];
+        if (BUDGETS[owner].bytes[1] > 0) total += _heap[owner][1];
+    }
+    return total;
+}
+
+void MemoryArena::printReport() const {
+    Serial.println("Memory map (bytes used / budget):");
+    Serial.printf("  %-12s %8s / %-8s %9s / %-8s\n", "", REGION_NAMES[0], "budget", REGION_NAMES[1], "budget");
+    
+    size_t used[ARENA_REGION_COUNT] = {};
+    size_t budget[ARENA_REGION_COUNT] = {};
+    for (uint8_t owner = 0; owner < ARENA_OWNER_COUNT; owner++) {
+        size_t ownerUsed[ARENA_REGION_COUNT];
+        for (uint8_t region = 0; region < ARENA_REGION_COUNT; region++) {
+            ownerUsed[region] = getUsed((ArenaOwner)owner, (ArenaRegion)region);
+            used[region] += ownerUsed[region];
+            budget[region] += BUDGETS[owner].bytes[region];
+        }
+        if (ownerUsed[0] == 0 && ownerUsed[1] == 0 &&
+            BUDGETS[owner].bytes[0] == 0 && BUDGETS[owner].bytes[1] == 0) continue;
+        
+        Serial.printf("  %-12s %8u / %-8u %9u / %-8u%s\n", BUDGETS[owner].name,
+                      (unsigned)ownerUsed[0], (unsigned)BUDGETS[owner].bytes[0],
+                      (unsigned)ownerUsed[1], (unsigned)BUDGETS[owner].bytes[1],
+                      (_heap[owner][0] || _heap[owner][1]) ? "  (heap)" : "");
+    }
+    
+    Serial.printf("  %-12s %8u / %-8u %9u / %-8u\n", "total",
+                  (unsigned)used[0], (unsigned)budget[0], (unsigned)used[1], (unsigned)budget[1]);
+    Serial.printf("  %-12s %8u %21u\n", "free",
+                  (unsigned)heap_caps_get_free_size(REGION_CAPS[0]),
+                  (unsigned)heap_caps_get_free_size(REGION_CAPS[1]));
+    if (getOverflow() > 0) {
+        Serial.printf("WARNING: %u bytes over budget\n", (unsigned)getOverflow());
+    }
+}
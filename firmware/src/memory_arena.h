@@ -0,0 +1,106 @@
+/**
+ * Ada Particles - Boot-Time Memory Arena
+ *
+ * Every long-lived buffer comes from here instead of its own
+ * ps_malloc / malloc. At boot the arena reserves one block of
+ * internal SRAM and one of PSRAM, sized from the budget table in
+ * memory_arena.cpp, and gives each subsystem its own slice of each.
+ * Allocations bump through the owner's slice and are never freed;
+ * all of them start on a MEMORY_ALIGN boundary, so any of them can
+ * be a DMA source.
+ *
+ * A request that does not fit the owner's budget still succeeds from
+ * the heap, but is counted against the owner, and the memory map
+ * (printReport) flags it, so a subsystem that outgrows its budget
+ * shows up at boot instead of as a failed allocation later.
+ */
+
+#ifndef MEMORY_ARENA_H
+#define MEMORY_ARENA_H
+
+#include <Arduino.h>
+#include "../config.h"
+
+// Round a size up to the arena alignment
+#define MEMORY_ROUND(bytes) (((bytes) + MEMORY_ALIGN - 1) & ~(size_t)(MEMORY_ALIGN - 1))
+
+// Subsystems, in budget table order
+enum ArenaOwner : uint8_t {
+    ARENA_FRAMEBUFFER = 0,
+    ARENA_PARTICLES,
+    ARENA_SPRITES,
+    ARENA_IMAGE_ENGINE,
+    ARENA_MESSAGE_LOG,
+    
+    ARENA_OWNER_COUNT
+};
+
+enum ArenaPlacement : uint8_t {
+    ARENA_INTERNAL = 0,     // Internal SRAM, else PSRAM
+    ARENA_INTERNAL_ONLY,    // Internal SRAM or nothing (caller has a slower path)
+    ARENA_PSRAM             // PSRAM, else internal SRAM
+};
+
+enum ArenaRegion : uint8_t {
+    ARENA_REGION_INTERNAL = 0,
+    ARENA_REGION_PSRAM,
+    
+    ARENA_REGION_COUNT
+};
+
+class MemoryArena {
+public:
+    MemoryArena();
+    
+    /**
+     * Reserve both regions from the budget table. Happens on the
+     * first alloc() if not called earlier.
+     * @return false if a region could not be reserved (its owners
+     *         then allocate from the heap)
+     */
+    bool init();
+    
+    /**
+     * Allocate a buffer for the lifetime of the program.
+     * @return MEMORY_ALIGN-aligned memory, or nullptr
+     */
+    void* alloc(ArenaOwner owner, size_t bytes, ArenaPlacement placement);
+    
+    /**
+     * Bytes an owner holds in a region (budget and heap), and its
+     * budget there.
+     */
+    size_t getUsed(ArenaOwner owner, ArenaRegion region) const {
+        return _used[owner][region] + _heap[owner][region];
+    }
+    size_t getBudget(ArenaOwner owner, ArenaRegion region) const;
+    
+    /**
+     * Bytes taken from the heap because a budget was short.
+     */
+    size_t getOverflow() const;
+    
+    /**
+     * Print the per-subsystem memory map to Serial.
+     */
+    void printReport() const;
+
+private:
+    uint8_t* _base[ARENA_REGION_COUNT];
+    bool _reserved;
+    
+    // Each owner's slice: start offset in the region, bytes used in
+    // it, and bytes taken from the heap once it was full
+    size_t _start[ARENA_OWNER_COUNT][ARENA_REGION_COUNT];
+    size_t _used[ARENA_OWNER_COUNT][ARENA_REGION_COUNT];
+    size_t _heap[ARENA_OWNER_COUNT][ARENA_REGION_COUNT];
+    
+    // Take from the owner's slice, or from the region's heap
+    void* take(ArenaOwner owner, uint8_t region, size_t bytes);
+    void* fromHeap(ArenaOwner owner, uint8_t region, size_t bytes);
+};
+
+// Global instance
+extern MemoryArena memoryArena;
+
+#endif // MEMORY_ARENA_H
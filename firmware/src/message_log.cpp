@@ -0,0 +1,226 @@
+/**
+ * Ada Particles - Server Message Log Implementation
+ */
+
+#include "message_log.h"
+#include "memory_arena.h"
+
+#ifdef MESSAGE_LOG
+
+// Record header; the message follows, padded to 4 bytes
+struct RecordHeader {
+    uint32_t timeMs;
+    uint32_t info;      // Length, plus RECORD_BINARY
+};
+
+static const uint32_t RECORD_BINARY = 0x80000000u;
+
+static inline uint32_t recordSize(uint32_t len) {
+    return sizeof(RecordHeader) + ((len + 3) & ~3u);
+}
+
+MessageLog::MessageLog()
+    : _buffer(nullptr)
+    , _size(0)
+    , _head(0)
+    , _tail(0)
+    , _wrapAt(0)
+    , _count(0)
+    , _dropped(0)
+{
+}
+
+bool MessageLog::init(size_t size) {
+    _buffer = (uint8_t*)memoryArena.alloc(ARENA_MESSAGE_LOG, size, ARENA_PSRAM);
+    if (!_buffer) {
+        DEBUG_PRINTLN("Failed to allocate message log");
+        return false;
+    }
+    
+    _size = size & ~3u;
+    clear();
+    return true;
+}
+
+void MessageLog::clear() {
+    _head = 0;
+    _tail = 0;
+    _wrapAt = _size;
+    _count = 0;
+    _dropped = 0;
+}
+
+void MessageLog::evict() {
+    const RecordHeader* header = (const RecordHeader*)(_buffer + _tail);
+    _tail += recordSize(header->info & ~RECORD_BINARY);
+    _count--;
+    _dropped++;
+    
+    if (_count == 0) {
+        _head = 0;
+        _tail = 0;
+        _wrapAt = _size;
+    } else if (_tail >= _wrapAt) {
+        // Oldest run used up; the rest starts at 0
+        _tail = 0;
+        _wrapAt = _size;
+    }
+}
+
+bool MessageLog::record(uint32_t timeMs, const uint8_t* data, size_t len, bool binary) {
+    if (!_buffer || len >= RECORD_BINARY) return false;
+    
+    uint32_t need = recordSize(len);
+    if (need > _size) return false;
+    
+    // Find room at _head, dropping the oldest records in the way
+    for (;;) {
+        bool wrapped = _count > 0 && _head <= _tail;
+        if (wrapped) {
+            if (_tail - _head >= need) break;
+            evict();
+        } else if (_size - _head >= need) {
+            break;
+        } else {
+            // No room before the end: continue from the start
+            _wrapAt = _head;
+            _head = 0;
+            if (_count == 0) {
+                _tail = 0;
+                _wrapAt = _size;
+            }
+        }
+    }
+    
+    RecordHeader* header = (RecordHeader*)(_buffer + _head);
+    header->timeMs = timeMs;
+    header->info = (uint32_t)len | (binary ? RECORD_BINARY : 0);
+    memcpy(_buffer + _head + sizeof(RecordHeader), data, len);
+    
+    _head += need;
+    _count++;
+    return true;
+}
+
+bool MessageLog::next(Cursor& cursor, LoggedMessage& out) const {
+    if (cursor.remaining == 0) return false;
+    if (cursor.offset >= _wrapAt) cursor.offset = 0;
+    
+    const RecordHeader* header = (const RecordHeader*)(_buffer + cursor.offset);
+    out.timeMs = header->timeMs;
+    out.len = header->info & ~RECORD_BINARY;
+    out.binary = (header->info & RECORD_BINARY) != 0;
+    out.data = _buffer + cursor.offset + sizeof(RecordHeader);
+    
+    cursor.offset += recordSize(out.len);
+    cursor.remaining--;
+    return true;
+}
+
+// ============================================
+// Text Dump
+// ============================================
+
+static void printHex(const uint8_t* data, uint32_t len) {
+    static const char DIGITS[] = "0123456789abcdef";
+    char chunk[65];
+    uint32_t n = 0;
+    
+    for (uint32_t i = 0; i < len; i++) {
+        chunk[n++] = DIGITS[data[i] >> 4];
+        chunk[n++] = DIGITS[data[i] & 0x0F];
+        if (n == sizeof(chunk) - 1 || i == len - 1) {
+            chunk[n] = '\0';
+            Serial.print(chunk);
+            n = 0;
+        }
+    }
+}
+
+void MessageLog::dump() const {
+    Serial.printf("@log %u messages, %u dropped\n", (unsigned)_count, (unsigned)_dropped);
+    
+    Cursor cursor = begin();
+    LoggedMessage msg;
+    while (next(cursor, msg)) {
+        bool plain = !msg.binary && !memchr(msg.data, '\n', msg.len) && !memchr(msg.data, '\r', msg.len);
+        Serial.printf("%u %c ", (unsigned)msg.timeMs, msg.binary ? 'B' : (plain ? 'T' : 'X'));
+        if (plain) {
+            Serial.write(msg.data, msg.len);
+        } else {
+            printHex(msg.data, msg.len);
+        }
+        Serial.println();
+    }
+    
+    Serial.println("@end");
+}
+
+static int hexDigit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+bool MessageLog::loadLine(const char* line) {
+    size_t len = strlen(line);
+    while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) len--;
+    if (len == 0 || line[0] == '@' || line[0] == '#') return true;
+    
+    // <ms> <kind> <payload>
+    char* end;
+    uint32_t timeMs = strtoul(line, &end, 10);
+    if (end == line || end[0] != ' ' || end[1] == '\0' || (end[2] != ' ' && end[2] != '\0')) return false;
+    
+    char kind = end[1];
+    const char* payload = end[2] ? end + 3 : end + 2;
+    size_t payloadLen = len - (payload - line);
+    
+    if (kind == 'T') {
+        return record(timeMs, (const uint8_t*)payload, payloadLen, false);
+    }
+    if ((kind != 'X' && kind != 'B') || (payloadLen & 1)) return false;
+    
+    size_t bytes = payloadLen / 2;
+    uint8_t* data = (uint8_t*)malloc(bytes ? bytes : 1);
+    if (!data) return false;
+    
+    bool ok = true;
+    for (size_t i = 0; i < bytes && ok; i++) {
+        int hi = hexDigit(payload[i * 2]);
+        int lo = hexDigit(payload[i * 2 + 1]);
+        ok = hi >= 0 && lo >= 0;
+        data[i] = (uint8_t)((hi << 4) | lo);
+    }
+    
+    ok = ok && record(timeMs, data, bytes, kind == 'B');
+    free(data);
+    return ok;
+}
+
+// ============================================
+// Replay
+// ============================================
+
+void MessageReplay::start(const MessageLog& log, uint32_t nowMs) {
+    _log = &log;
+    _cursor = log.begin();
+    _startMs = nowMs;
+    _active = log.next(_cursor, _pending);
+    _baseMs = _active ? _pending.timeMs : 0;
+}
+
+int MessageReplay::poll(uint32_t nowMs, void (*deliver)(const LoggedMessage& msg)) {
+    int delivered = 0;
+    
+    while (_active && _pending.timeMs - _baseMs <= nowMs - _startMs) {
+        deliver(_pending);
+        delivered++;
+        _active = _log->next(_cursor, _pending);
+    }
+    
+    return delivered;
+}
+
+#endif // MESSAGE_LOG
@@ -0,0 +1,157 @@
+/**
+ * Ada Particles - Server Message Log
+ *
+ * Records the server's WebSocket messages, each with its arrival time,
+ * into a PSRAM ring so a session can be played back later: the same
+ * messages, at the same relative times, through the same handler.
+ * Records are stored whole and back to back; when the ring is full
+ * the oldest are dropped to make room.
+ *
+ * The log dumps to Serial as text, one message per line, and the host
+ * bench reads that text back, so a session captured on the device can
+ * be replayed on a desktop:
+ *
+ *   @log <count> messages, <dropped> dropped
+ *   <ms> T <json>        text message
+ *   <ms> X <hex>         text message containing a line break
+ *   <ms> B <hex>         binary message
+ *   @end
+ *
+ * Without MESSAGE_LOG nothing here is compiled.
+ */
+
+#ifndef MESSAGE_LOG_H
+#define MESSAGE_LOG_H
+
+#include <Arduino.h>
+#include "../config.h"
+
+#ifdef MESSAGE_LOG
+
+/**
+ * One recorded message. data points into the log and stays valid
+ * until the log records over it or is cleared.
+ */
+struct LoggedMessage {
+    uint32_t timeMs;
+    const uint8_t* data;
+    uint32_t len;
+    bool binary;
+};
+
+// ============================================
+// Message Log
+// ============================================
+
+class MessageLog {
+public:
+    /**
+     * Position of an iteration, oldest message first.
+     */
+    struct Cursor {
+        uint32_t offset;
+        uint32_t remaining;
+    };
+    
+    MessageLog();
+    
+    /**
+     * Allocate the ring in PSRAM.
+     * @return true if successful
+     */
+    bool init(size_t size = MESSAGE_LOG_SIZE);
+    
+    /**
+     * Append a message, dropping the oldest until it fits.
+     * @return false if the message is larger than the whole ring
+     */
+    bool record(uint32_t timeMs, const uint8_t* data, size_t len, bool binary);
+    
+    /**
+     * Drop every message.
+     */
+    void clear();
+    
+    /**
+     * Messages held, and messages dropped to make room since clear().
+     */
+    uint32_t getCount() const { return _count; }
+    uint32_t getDropped() const { return _dropped; }
+    
+    /**
+     * Iterate: Cursor c = log.begin(); while (log.next(c, msg)) ...
+     * Recording during an iteration invalidates it.
+     */
+    Cursor begin() const { return { _tail, _count }; }
+    bool next(Cursor& cursor, LoggedMessage& out) const;
+    
+    /**
+     * Print the log to Serial in the text format above.
+     */
+    void dump() const;
+    
+    /**
+     * Record one line of a dump. Markers, comments (#) and blank
+     * lines are skipped.
+     * @return false if the line is malformed
+     */
+    bool loadLine(const char* line);
+
+private:
+    uint8_t* _buffer;
+    uint32_t _size;
+    
+    // Records run from _tail to _head. Once wrapped, the oldest run
+    // from _tail to _wrapAt and the newest from 0 to _head.
+    uint32_t _head;
+    uint32_t _tail;
+    uint32_t _wrapAt;
+    uint32_t _count;
+    uint32_t _dropped;
+    
+    // Drop the oldest record
+    void evict();
+};
+
+// ============================================
+// Replay
+// ============================================
+
+/**
+ * Delivers a log's messages with their original spacing, starting
+ * from the time replay starts.
+ */
+class MessageReplay {
+public:
+    MessageReplay() : _log(nullptr), _active(false) {}
+    
+    /**
+     * Start from the oldest message in the log.
+     */
+    void start(const MessageLog& log, uint32_t nowMs);
+    
+    void stop() { _active = false; }
+    
+    /**
+     * Check if messages are still to come.
+     */
+    bool isActive() const { return _active; }
+    
+    /**
+     * Deliver every message that is due by nowMs.
+     * @return Number of messages delivered
+     */
+    int poll(uint32_t nowMs, void (*deliver)(const LoggedMessage& msg));
+
+private:
+    const MessageLog* _log;
+    MessageLog::Cursor _cursor;
+    LoggedMessage _pending;
+    uint32_t _startMs;      // When replay started
+    uint32_t _baseMs;       // Recorded time of the first message
+    bool _active;
+};
+
+#endif // MESSAGE_LOG
+
+#endif // MESSAGE_LOG_H
@@ -0,0 +1,90 @@
+/**
+ * Ada Particles - Morton (Z-order) Keys
+ *
+ * A Morton key interleaves the bits of a screen position's x and y,
+ * so points that are close on screen mostly get close keys. Sorting
+ * by key lays items out along a Z-shaped curve over the screen:
+ * neighbors end up near each other in memory, and two sorted sets can
+ * be paired by rank to match up nearby points.
+ */
+
+#ifndef MORTON_H
+#define MORTON_H
+
+#include <Arduino.h>
+#include "../config.h"
+
+#define MORTON_AXIS_BITS 9
+#define MORTON_KEY_BITS (2 * MORTON_AXIS_BITS)
+
+static_assert(SCREEN_WIDTH <= (1 << MORTON_AXIS_BITS) && SCREEN_HEIGHT <= (1 << MORTON_AXIS_BITS),
+              "screen coordinates must fit in MORTON_AXIS_BITS");
+static_assert(MORTON_KEY_BITS / MORTON_AXIS_BITS == 2, "morton_sort() runs exactly two passes");
+
+/**
+ * Spread the low 9 bits of v to the even bits (bit i -> bit 2i).
+ */
+inline uint32_t morton_spread(uint32_t v) {
+    v &= (1 << MORTON_AXIS_BITS) - 1;
+    v = (v | (v << 8)) & 0x00FF00FF;
+    v = (v | (v << 4)) & 0x0F0F0F0F;
+    v = (v | (v << 2)) & 0x33333333;
+    v = (v | (v << 1)) & 0x55555555;
+    return v;
+}
+
+/**
+ * Key of a screen pixel; positions off screen are clamped to the edge.
+ * @return MORTON_KEY_BITS-bit key
+ */
+inline uint32_t morton_key(int x, int y) {
+    x = constrain(x, 0, SCREEN_WIDTH - 1);
+    y = constrain(y, 0, SCREEN_HEIGHT - 1);
+    return morton_spread(x) | (morton_spread(y) << 1);
+}
+
+/**
+ * Sort ids by key, keeping equal keys in their original order (LSD
+ * radix sort, MORTON_AXIS_BITS per pass).
+ * @param keys Keys, sorted in place
+ * @param ids Ids moved with their keys
+ * @param n Entry count (at most 65535)
+ * @param tmpKeys Scratch, n entries
+ * @param tmpIds Scratch, n entries
+ */
+inline void morton_sort(uint32_t* keys, uint16_t* ids, int n, uint32_t* tmpKeys, uint16_t* tmpIds) {
+    const int BUCKETS = 1 << MORTON_AXIS_BITS;
+    uint16_t start[BUCKETS];
+
+    for (int shift = 0; shift < MORTON_KEY_BITS; shift += MORTON_AXIS_BITS) {
+        memset(start, 0, sizeof(start));
+        for (int i = 0; i < n; i++) {
+            start[(keys[i] >> shift) & (BUCKETS - 1)]++;
+        }
+
+        // Counts -> first slot of each bucket
+        uint16_t sum = 0;
+        for (int b = 0; b < BUCKETS; b++) {
+            uint16_t count = start[b];
+            start[b] = sum;
+            sum += count;
+        }
+
+        for (int i = 0; i < n; i++) {
+            uint16_t slot = start[(keys[i] >> shift) & (BUCKETS - 1)]++;
+            tmpKeys[slot] = keys[i];
+            tmpIds[slot] = ids[i];
+        }
+
+        // The next pass reads the sorted copy; after the second, the
+        // result is back in the caller's arrays
+        uint32_t* swapKeys = keys;
+        keys = tmpKeys;
+        tmpKeys = swapKeys;
+        uint16_t* swapIds = ids;
+        ids = tmpIds;
+        tmpIds = swapIds;
+    }
+}
+
+#endif // MORTON_H
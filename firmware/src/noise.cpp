@@ -74,6 +74,30 @@ static inline int32_t grad3_dot(int gi, int32_t x, int32_t y, int32_t z) {
     return grad3[gi][0] * x + grad3[gi][1] * y + grad3[gi][2] * z;
 }
 
+// Accumulate one 3D corner's value and analytic gradient.
+// With t = 0.3 - r^2 the corner adds n = t^4 (g.d), so
+// dn/dd = t^4 g - 8 t^3 (g.d) d. All four sums use the same
+// units as the n0..n3 sum in noise16_3d.
+static inline void grad3_corner(int gi, int32_t x, int32_t y, int32_t z, int64_t acc[4]) {
+    int32_t t = (FIXED_HALF * 6 / 10) - (((int64_t)x * x + (int64_t)y * y + (int64_t)z * z) >> 16);
+    if (t <= 0) return;
+    
+    int32_t t2 = (t * t) >> 16;
+    int32_t t3 = (t2 * t) >> 16;
+    int32_t t4 = (t2 * t2) >> 16;
+    
+    x >>= 8;
+    y >>= 8;
+    z >>= 8;
+    int32_t gd = grad3_dot(gi, x, y, z);
+    int64_t w = (int64_t)8 * t3 * gd;
+    
+    acc[0] += (int64_t)t4 * gd;
+    acc[1] += ((int64_t)t4 * grad3[gi][0] << 8) - ((w * x) >> 8);
+    acc[2] += ((int64_t)t4 * grad3[gi][1] << 8) - ((w * y) >> 8);
+    acc[3] += ((int64_t)t4 * grad3[gi][2] << 8) - ((w * z) >> 8);
+}
+
 // ============================================
 // 2D Simplex Noise
 // ============================================
@@ -90,8 +114,8 @@ uint16_t noise16_2d(uint32_t x, uint32_t y) {
     int32_t i = fastfloor(x + s);
     int32_t j = fastfloor(y + s);
     
-    // Unskew
-    int32_t t = ((int64_t)(i + j) * G2) >> 16;
+    // Unskew (integer cell index times a 16.16 factor: no shift)
+    int32_t t = (i + j) * G2;
     int32_t X0 = (i << 16) - t;
     int32_t Y0 = (j << 16) - t;
     
@@ -166,8 +190,8 @@ uint16_t noise16_3d(uint32_t x, uint32_t y, uint32_t z) {
     int32_t j = fastfloor(y + s);
     int32_t k = fastfloor(z + s);
     
-    // Unskew
-    int32_t t = ((int64_t)(i + j + k) * G3) >> 16;
+    // Unskew (integer cell index times a 16.16 factor: no shift)
+    int32_t t = (i + j + k) * G3;
     int32_t X0 = (i << 16) - t;
     int32_t Y0 = (j << 16) - t;
     int32_t Z0 = (k << 16) - t;
@@ -249,6 +273,62 @@ uint16_t noise16_3d(uint32_t x, uint32_t y, uint32_t z) {
     return (uint16_t)constrain(result, 0, 65535);
 }
 
+// ============================================
+// 3D Simplex Noise with Gradient
+// ============================================
+
+uint16_t noise16_3d_grad(uint32_t x, uint32_t y, uint32_t z,
+                         int32_t* dx, int32_t* dy, int32_t* dz) {
+    // Same lattice walk as noise16_3d
+    const int32_t F3 = 21845;
+    const int32_t G3 = 10923;
+    
+    int32_t s = ((int64_t)(x + y + z) * F3) >> 16;
+    int32_t i = fastfloor(x + s);
+    int32_t j = fastfloor(y + s);
+    int32_t k = fastfloor(z + s);
+    
+    int32_t t = (i + j + k) * G3;
+    int32_t x0 = x - ((i << 16) - t);
+    int32_t y0 = y - ((j << 16) - t);
+    int32_t z0 = z - ((k << 16) - t);
+    
+    int i1, j1, k1, i2, j2, k2;
+    if (x0 >= y0) {
+        if (y0 >= z0) { i1=1; j1=0; k1=0; i2=1; j2=1; k2=0; }
+        else if (x0 >= z0) { i1=1; j1=0; k1=0; i2=1; j2=0; k2=1; }
+        else { i1=0; j1=0; k1=1; i2=1; j2=0; k2=1; }
+    } else {
+        if (y0 < z0) { i1=0; j1=0; k1=1; i2=0; j2=1; k2=1; }
+        else if (x0 < z0) { i1=0; j1=1; k1=0; i2=0; j2=1; k2=1; }
+        else { i1=0; j1=1; k1=0; i2=1; j2=1; k2=0; }
+    }
+    
+    int ii = i & 255;
+    int jj = j & 255;
+    int kk = k & 255;
+    
+    // acc[0] = value, acc[1..3] = d/dx, d/dy, d/dz
+    int64_t acc[4] = {0, 0, 0, 0};
+    
+    grad3_corner(perm[ii + perm[jj + perm[kk]]] % 12,
+                 x0, y0, z0, acc);
+    grad3_corner(perm[ii + i1 + perm[jj + j1 + perm[kk + k1]]] % 12,
+                 x0 - (i1 << 16) + G3, y0 - (j1 << 16) + G3, z0 - (k1 << 16) + G3, acc);
+    grad3_corner(perm[ii + i2 + perm[jj + j2 + perm[kk + k2]]] % 12,
+                 x0 - (i2 << 16) + (G3 * 2), y0 - (j2 << 16) + (G3 * 2), z0 - (k2 << 16) + (G3 * 2), acc);
+    grad3_corner(perm[ii + 1 + perm[jj + 1 + perm[kk + 1]]] % 12,
+                 x0 - FIXED_ONE + (G3 * 3), y0 - FIXED_ONE + (G3 * 3), z0 - FIXED_ONE + (G3 * 3), acc);
+    
+    // Same scale as the value: noise units per 1.0 of input
+    *dx = (int32_t)(acc[1] >> 5);
+    *dy = (int32_t)(acc[2] >> 5);
+    *dz = (int32_t)(acc[3] >> 5);
+    
+    int32_t result = (acc[0] >> 5) + 32768;
+    return (uint16_t)constrain(result, 0, 65535);
+}
+
 // ============================================
 // Fractal Noise
 // ============================================
@@ -279,6 +359,43 @@ uint16_t noise16_fractal(uint32_t x, uint32_t y, uint32_t z, uint8_t octaves) {
     return (uint16_t)constrain(normalized, 0, 65535);
 }
 
+uint16_t noise16_fractal_grad(uint32_t x, uint32_t y, uint32_t z, uint8_t octaves,
+                              int32_t* dx, int32_t* dy, int32_t* dz) {
+    int32_t total = 0;
+    int64_t gx = 0, gy = 0, gz = 0;
+    int32_t maxValue = 0;
+    int32_t amplitude = FIXED_ONE;
+    uint32_t frequency = FIXED_ONE;
+    
+    octaves = constrain(octaves, 1, 4);
+    
+    for (int i = 0; i < octaves; i++) {
+        uint32_t sx = (uint32_t)(((int64_t)x * frequency) >> 16);
+        uint32_t sy = (uint32_t)(((int64_t)y * frequency) >> 16);
+        uint32_t sz = (uint32_t)(((int64_t)z * frequency) >> 16);
+        
+        int32_t ox, oy, oz;
+        int32_t noise = (int32_t)noise16_3d_grad(sx, sy, sz, &ox, &oy, &oz) - 32768;
+        total += (noise * amplitude) >> 16;
+        
+        // Chain rule: each octave's slope scales by amplitude * frequency
+        gx += ((int64_t)ox * amplitude >> 16) << i;
+        gy += ((int64_t)oy * amplitude >> 16) << i;
+        gz += ((int64_t)oz * amplitude >> 16) << i;
+        
+        maxValue += amplitude;
+        amplitude >>= 1;
+        frequency <<= 1;
+    }
+    
+    *dx = (int32_t)((gx << 16) / maxValue);
+    *dy = (int32_t)((gy << 16) / maxValue);
+    *dz = (int32_t)((gz << 16) / maxValue);
+    
+    int32_t normalized = ((total << 16) / maxValue) + 32768;
+    return (uint16_t)constrain(normalized, 0, 65535);
+}
+
 // ============================================
 // Curl Noise
 // ============================================
@@ -287,21 +404,16 @@ void curl_noise_2d(uint32_t x, uint32_t y, uint32_t t,
                    fixed_t* out_vx, fixed_t* out_vy) {
     // Curl noise creates divergence-free flow
     // curl(x,y) = (dN/dy, -dN/dx)
-    // We approximate derivatives with finite differences
-    
-    const uint32_t eps = 1000;  // Small epsilon for derivative
+    // Both partials come from a single analytic-gradient evaluation
     
-    // Sample noise at offset points
-    uint16_t n_px = noise16_3d(x + eps, y, t);
-    uint16_t n_mx = noise16_3d(x - eps, y, t);
-    uint16_t n_py = noise16_3d(x, y + eps, t);
-    uint16_t n_my = noise16_3d(x, y - eps, t);
+    int32_t dndx, dndy, dndt;
+    noise16_3d_grad(x, y, t, &dndx, &dndy, &dndt);
     
-    // Approximate partial derivatives
-    int32_t dndx = ((int32_t)n_px - (int32_t)n_mx);
-    int32_t dndy = ((int32_t)n_py - (int32_t)n_my);
+    // Match the scale of the former +/-1000 central difference,
+    // which spanned 2000/65536 of an input unit
+    const int32_t CURL_SCALE = 2000;
     
     // Curl: rotate 90 degrees
-    *out_vx = dndy;      // dN/dy
-    *out_vy = -dndx;     // -dN/dx
+    *out_vx = (fixed_t)(((int64_t)dndy * CURL_SCALE) >> 16);    // dN/dy
+    *out_vy = (fixed_t)(-(((int64_t)dndx * CURL_SCALE) >> 16)); // -dN/dx
 }
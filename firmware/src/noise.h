@@ -37,6 +37,17 @@ uint16_t noise16_2d(uint32_t x, uint32_t y);
  */
 uint16_t noise16_3d(uint32_t x, uint32_t y, uint32_t z);
 
+/**
+ * 3D Simplex noise with analytic partial derivatives, from a single
+ * simplex evaluation. The value matches noise16_3d().
+ * 
+ * @param dx, dy, dz Output slope in noise units (0-65535 scale)
+ *                   per 1.0 of input (per 65536 in 16.16)
+ * @return Noise value 0-65535
+ */
+uint16_t noise16_3d_grad(uint32_t x, uint32_t y, uint32_t z,
+                         int32_t* dx, int32_t* dy, int32_t* dz);
+
 /**
  * Fractal/octave noise (2D with time).
  * Combines multiple octaves for richer detail.
@@ -49,6 +60,14 @@ uint16_t noise16_3d(uint32_t x, uint32_t y, uint32_t z);
  */
 uint16_t noise16_fractal(uint32_t x, uint32_t y, uint32_t z, uint8_t octaves);
 
+/**
+ * Fractal noise with its octave-summed analytic gradient.
+ * The value matches noise16_fractal(); the slope uses the same
+ * units as noise16_3d_grad().
+ */
+uint16_t noise16_fractal_grad(uint32_t x, uint32_t y, uint32_t z, uint8_t octaves,
+                              int32_t* dx, int32_t* dy, int32_t* dz);
+
 /**
  * Get signed noise value (-32768 to +32767).
  * Useful for velocity offsets.
@@ -3,6 +3,7 @@
  */
 
 #include "particle.h"
+#include "memory_arena.h"
 
 // Global instance
 ParticlePool particlePool;
@@ -12,7 +13,9 @@ ParticlePool particlePool;
 // ============================================
 
 ParticlePool::ParticlePool() 
-    : _particles(nullptr), _activeCount(0) {
+    : _hot(nullptr), _cold(nullptr), _activeCount(0)
+    , _active(nullptr), _link(nullptr), _freeHead(-1) {
+    memset(&_p, 0, sizeof(_p));
 }
 
 // ============================================
@@ -20,98 +23,105 @@ ParticlePool::ParticlePool()
 // ============================================
 
 bool ParticlePool::init() {
-    size_t bytes = sizeof(Particle) * MAX_PARTICLES;
+    const size_t n = MAX_PARTICLES;
     
-    // Allocate in PSRAM
-    _particles = (Particle*)ps_malloc(bytes);
-    if (!_particles) {
-        _particles = (Particle*)malloc(bytes);
-    }
+    // Widest arrays first so every array stays aligned
+    size_t hotBytes = n * PARTICLE_HOT_BYTES;
+    size_t coldBytes = n * PARTICLE_COLD_BYTES;
+    
+    // Hot arrays in internal SRAM, cold arrays in PSRAM
+    _hot = (uint8_t*)memoryArena.alloc(ARENA_PARTICLES, hotBytes, ARENA_INTERNAL);
+    _cold = (uint8_t*)memoryArena.alloc(ARENA_PARTICLES, coldBytes, ARENA_PSRAM);
     
-    if (!_particles) {
+    if (!_hot || !_cold) {
         Serial.println("ERROR: Failed to allocate particle pool!");
+        _hot = nullptr;
+        _cold = nullptr;
         return false;
     }
     
-    // Initialize all particles as inactive
-    memset(_particles, 0, bytes);
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        _particles[i].state = PARTICLE_INACTIVE;
-    }
-    
-    _activeCount = 0;
-    
-    Serial.printf("Particle pool: %d particles (%d bytes)\n", 
-                  MAX_PARTICLES, bytes);
+    memset(_hot, 0, hotBytes);
+    memset(_cold, 0, coldBytes);
+    
+    fixed_t* hotWords = (fixed_t*)_hot;
+    _p.x = hotWords;
+    _p.y = hotWords + n;
+    _p.vx = hotWords + 2 * n;
+    _p.vy = hotWords + 3 * n;
+    _p.prevX = hotWords + 4 * n;
+    _p.prevY = hotWords + 5 * n;
+    _p.targetX = hotWords + 6 * n;
+    _p.targetY = hotWords + 7 * n;
+    _active = (uint16_t*)(hotWords + 8 * n);
+    _link = _active + n;
+    _p.state = (uint8_t*)(_link + n);
+    _p.hasTarget = _p.state + n;
+    
+    fixed_t* coldWords = (fixed_t*)_cold;
+    _p.phase = coldWords;
+    _p.noiseOffsetX = coldWords + n;
+    _p.noiseOffsetY = coldWords + 2 * n;
+    _p.sizeIdx = (uint8_t*)(coldWords + 3 * n);
+    _p.brightness = _p.sizeIdx + n;
+    _p.fadeProgress = _p.brightness + n;
+    
+    // All particles start inactive (PARTICLE_INACTIVE == 0)
+    resetLists();
+    
+    Serial.printf("Particle pool: %d particles (%d bytes SRAM, %d bytes PSRAM)\n", 
+                  MAX_PARTICLES, hotBytes, coldBytes);
     
     return true;
 }
 
-// ============================================
-// Access
-// ============================================
-
-Particle& ParticlePool::get(int index) {
-    static Particle dummy = {0};
-    if (!_particles || index < 0 || index >= MAX_PARTICLES) {
-        return dummy;
-    }
-    return _particles[index];
-}
-
-const Particle& ParticlePool::get(int index) const {
-    static Particle dummy = {0};
-    if (!_particles || index < 0 || index >= MAX_PARTICLES) {
-        return dummy;
-    }
-    return _particles[index];
-}
-
 // ============================================
 // Activation / Deactivation
 // ============================================
 
-int ParticlePool::findInactiveSlot() {
+void ParticlePool::resetLists() {
+    // Free list in slot order, so a fresh pool fills 0, 1, 2...
     for (int i = 0; i < MAX_PARTICLES; i++) {
-        if (_particles[i].state == PARTICLE_INACTIVE) {
-            return i;
-        }
+        _link[i] = i + 1;
     }
-    return -1;
+    _link[MAX_PARTICLES - 1] = NO_SLOT;
+    _freeHead = 0;
+    _activeCount = 0;
 }
 
-void ParticlePool::initParticle(Particle& p, fixed_t x, fixed_t y) {
-    p.x = x;
-    p.y = y;
-    p.vx = 0;
-    p.vy = 0;
-    p.targetX = 0;
-    p.targetY = 0;
-    p.hasTarget = false;
+void ParticlePool::initParticle(int i, fixed_t x, fixed_t y) {
+    _p.x[i] = x;
+    _p.y[i] = y;
+    _p.prevX[i] = x;
+    _p.prevY[i] = y;
+    _p.vx[i] = 0;
+    _p.vy[i] = 0;
+    _p.targetX[i] = 0;
+    _p.targetY[i] = 0;
+    _p.hasTarget[i] = 0;
     
     // Random size distribution (favor smaller particles)
     uint8_t sizeRoll = random(100);
     if (sizeRoll < 60) {
-        p.sizeIdx = 0;  // 60% small
+        _p.sizeIdx[i] = 0;  // 60% small
     } else if (sizeRoll < 90) {
-        p.sizeIdx = 1;  // 30% medium
+        _p.sizeIdx[i] = 1;  // 30% medium
     } else {
-        p.sizeIdx = 2;  // 10% large
+        _p.sizeIdx[i] = 2;  // 10% large
     }
     
     // Random brightness variation for visual interest
-    p.brightness = 180 + random(76);  // 180-255
+    _p.brightness[i] = 180 + random(76);  // 180-255
     
     // Random animation phase
-    p.phase = INT_TO_FIXED(random(1000)) / 1000;
+    _p.phase[i] = INT_TO_FIXED(random(1000)) / 1000;
     
     // Random noise offset (so particles don't all move in sync)
-    p.noiseOffsetX = INT_TO_FIXED(random(10000));
-    p.noiseOffsetY = INT_TO_FIXED(random(10000));
+    _p.noiseOffsetX[i] = INT_TO_FIXED(random(10000));
+    _p.noiseOffsetY[i] = INT_TO_FIXED(random(10000));
     
     // Start fading in
-    p.state = PARTICLE_FADING_IN;
-    p.fadeProgress = 0;
+    _p.state[i] = PARTICLE_FADING_IN;
+    _p.fadeProgress[i] = 0;
 }
 
 int ParticlePool::activate() {
@@ -124,35 +134,44 @@ int ParticlePool::activate() {
 }
 
 int ParticlePool::activateAt(fixed_t x, fixed_t y) {
-    if (!_particles) return -1;
+    if (!_hot || _freeHead < 0) return -1;
     
-    int slot = findInactiveSlot();
-    if (slot < 0) return -1;
+    // Pop the free list
+    int slot = _freeHead;
+    _freeHead = (_link[slot] == NO_SLOT) ? -1 : _link[slot];
     
-    Particle& p = _particles[slot];
-    initParticle(p, x, y);
+    initParticle(slot, x, y);
     
-    _activeCount++;
+    // Append to the live list
+    _link[slot] = _activeCount;
+    _active[_activeCount++] = slot;
     return slot;
 }
 
 void ParticlePool::deactivate(int index) {
-    if (!_particles || index < 0 || index >= MAX_PARTICLES) return;
+    if (!_hot || index < 0 || index >= MAX_PARTICLES) return;
+    if (_p.state[index] == PARTICLE_INACTIVE) return;
     
-    if (_particles[index].state != PARTICLE_INACTIVE) {
-        _particles[index].state = PARTICLE_INACTIVE;
-        _activeCount--;
-        if (_activeCount < 0) _activeCount = 0;
-    }
+    _p.state[index] = PARTICLE_INACTIVE;
+    
+    // Swap-remove from the live list
+    int pos = _link[index];
+    int last = _active[--_activeCount];
+    _active[pos] = last;
+    _link[last] = pos;
+    
+    // Push the free list
+    _link[index] = (_freeHead < 0) ? NO_SLOT : _freeHead;
+    _freeHead = index;
 }
 
 void ParticlePool::startFadeOut(int index) {
-    if (!_particles || index < 0 || index >= MAX_PARTICLES) return;
+    if (!_hot || index < 0 || index >= MAX_PARTICLES) return;
     
-    if (_particles[index].state == PARTICLE_ACTIVE || 
-        _particles[index].state == PARTICLE_FADING_IN) {
-        _particles[index].state = PARTICLE_FADING_OUT;
-        _particles[index].fadeProgress = 255;
+    if (_p.state[index] == PARTICLE_ACTIVE || 
+        _p.state[index] == PARTICLE_FADING_IN) {
+        _p.state[index] = PARTICLE_FADING_OUT;
+        _p.fadeProgress[index] = 255;
     }
 }
 
@@ -161,28 +180,31 @@ void ParticlePool::startFadeOut(int index) {
 // ============================================
 
 void ParticlePool::updateFades(float dt) {
-    if (!_particles) return;
+    if (!_hot) return;
     
     // Fade speed: 0 to 255 in ~0.5 seconds
     int fadeStep = (int)(dt * 512.0f);
     if (fadeStep < 1) fadeStep = 1;
     
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        Particle& p = _particles[i];
+    // Walk backwards so a swap-remove only moves visited entries
+    for (int k = _activeCount - 1; k >= 0; k--) {
+        int i = _active[k];
+        uint8_t state = _p.state[i];
         
-        if (p.state == PARTICLE_FADING_IN) {
-            p.fadeProgress += fadeStep;
-            if (p.fadeProgress >= 255) {
-                p.fadeProgress = 255;
-                p.state = PARTICLE_ACTIVE;
+        // Work in int so a step past either end clamps instead of
+        // wrapping the 8-bit progress
+        if (state == PARTICLE_FADING_IN) {
+            int progress = _p.fadeProgress[i] + fadeStep;
+            if (progress >= 255) {
+                progress = 255;
+                _p.state[i] = PARTICLE_ACTIVE;
             }
-        } else if (p.state == PARTICLE_FADING_OUT) {
-            p.fadeProgress -= fadeStep;
-            if (p.fadeProgress <= 0) {
-                p.fadeProgress = 0;
-                p.state = PARTICLE_INACTIVE;
-                _activeCount--;
-                if (_activeCount < 0) _activeCount = 0;
+            _p.fadeProgress[i] = progress;
+        } else if (state == PARTICLE_FADING_OUT) {
+            int progress = _p.fadeProgress[i] - fadeStep;
+            _p.fadeProgress[i] = max(progress, 0);
+            if (progress <= 0) {
+                deactivate(i);
             }
         }
     }
@@ -193,10 +215,8 @@ void ParticlePool::updateFades(float dt) {
 // ============================================
 
 void ParticlePool::clear() {
-    if (!_particles) return;
+    if (!_hot) return;
     
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        _particles[i].state = PARTICLE_INACTIVE;
-    }
-    _activeCount = 0;
+    memset(_p.state, PARTICLE_INACTIVE, MAX_PARTICLES);
+    resetLists();
 }
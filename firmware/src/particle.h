@@ -1,8 +1,17 @@
 /**
  * Ada Particles - Particle Data Structure
- * 
- * Defines the Particle struct and related types.
+ *
+ * Particles are stored as a structure of arrays: each field is its
+ * own contiguous array indexed by particle slot. The hot physics
+ * fields (position, velocity, formation target) and the lifecycle
+ * flags live in internal SRAM; everything that is set at spawn or
+ * read once per frame lives in PSRAM.
+ *
  * Particles use fixed-point math for efficient physics.
+ *
+ * The pool also keeps a dense list of live slots (swap-removed on
+ * deactivate) and an intrusive free list, so spawning and removal
+ * are O(1) and per-frame loops visit only live particles.
  */
 
 #ifndef PARTICLE_H
@@ -12,38 +21,6 @@
 #include "fixed_math.h"
 #include "../config.h"
 
-// ============================================
-// Particle Structure
-// ============================================
-
-struct Particle {
-    // Position (16.16 fixed-point, screen coordinates)
-    fixed_t x;
-    fixed_t y;
-    
-    // Velocity (16.16 fixed-point)
-    fixed_t vx;
-    fixed_t vy;
-    
-    // Target position for formations (-1 = no target, free floating)
-    fixed_t targetX;
-    fixed_t targetY;
-    bool hasTarget;
-    
-    // Visual properties
-    uint8_t sizeIdx;       // 0=small, 1=medium, 2=large
-    uint8_t brightness;    // 0-255 (varies per particle for visual interest)
-    
-    // Animation state
-    fixed_t phase;         // Random phase offset for variation
-    fixed_t noiseOffsetX;  // Offset into noise field
-    fixed_t noiseOffsetY;
-    
-    // Lifecycle
-    uint8_t state;         // 0=inactive, 1=active, 2=fading in, 3=fading out
-    uint8_t fadeProgress;  // 0-255 for fade in/out
-};
-
 // Particle states
 enum ParticleState : uint8_t {
     PARTICLE_INACTIVE = 0,
@@ -52,6 +29,37 @@ enum ParticleState : uint8_t {
     PARTICLE_FADING_OUT = 3
 };
 
+// ============================================
+// Particle Arrays
+// ============================================
+
+// Bytes per slot of the hot arrays (plus the pool's live and free
+// lists) and of the cold arrays
+#define PARTICLE_HOT_BYTES (8 * sizeof(fixed_t) + 2 * sizeof(uint16_t) + 2 * sizeof(uint8_t))
+#define PARTICLE_COLD_BYTES (3 * sizeof(fixed_t) + 3 * sizeof(uint8_t))
+
+struct ParticleArrays {
+    // Hot (internal SRAM): touched by every physics step
+    fixed_t* x;             // Position (16.16 fixed-point, screen coordinates)
+    fixed_t* y;
+    fixed_t* vx;            // Velocity (16.16 fixed-point)
+    fixed_t* vy;
+    fixed_t* prevX;         // Position before the last physics step
+    fixed_t* prevY;         // (render interpolates from here to x, y)
+    fixed_t* targetX;       // Target position for formations (read
+    fixed_t* targetY;       // every step while one is active)
+    uint8_t* state;         // ParticleState
+    uint8_t* hasTarget;     // 1 if targetX/targetY apply, else free floating
+    
+    // Cold (PSRAM)
+    fixed_t* phase;         // Random phase offset for variation
+    fixed_t* noiseOffsetX;  // Offset into noise field
+    fixed_t* noiseOffsetY;
+    uint8_t* sizeIdx;       // 0=small, 1=medium, 2=large
+    uint8_t* brightness;    // 0-255 (varies per particle for visual interest)
+    uint8_t* fadeProgress;  // 0-255 for fade in/out
+};
+
 // ============================================
 // Particle Pool
 // ============================================
@@ -61,16 +69,22 @@ public:
     ParticlePool();
     
     /**
-     * Initialize particle pool in PSRAM.
+     * Allocate the particle arrays (hot in SRAM, cold in PSRAM).
      * @return true if successful
      */
     bool init();
     
     /**
-     * Get particle by index.
+     * Get the particle arrays, indexed by slot (0 to getCapacity()-1).
      */
-    Particle& get(int index);
-    const Particle& get(int index) const;
+    ParticleArrays& arrays() { return _p; }
+    const ParticleArrays& arrays() const { return _p; }
+    
+    /**
+     * Get the dense list of live slots (getActiveCount() entries).
+     * Order is arbitrary and changes when particles are removed.
+     */
+    const uint16_t* activeList() const { return _active; }
     
     /**
      * Activate a particle at random position.
@@ -106,10 +120,11 @@ public:
     /**
      * Check if pool is valid.
      */
-    bool isValid() const { return _particles != nullptr; }
+    bool isValid() const { return _hot != nullptr; }
     
     /**
      * Update fade progress for all fading particles.
+     * Particles that finish fading out are removed from the list.
      * @param dt Delta time in seconds
      */
     void updateFades(float dt);
@@ -120,14 +135,24 @@ public:
     void clear();
 
 private:
-    Particle* _particles;
+    ParticleArrays _p;
+    uint8_t* _hot;      // Backing block for the hot arrays
+    uint8_t* _cold;     // Backing block for the cold arrays
     int _activeCount;
     
-    // Find first inactive slot
-    int findInactiveSlot();
+    // Live slots, and per slot either its index in _active (live)
+    // or the next free slot (free); _freeHead is -1 when full
+    static const uint16_t NO_SLOT = 0xFFFF;
+    static_assert(MAX_PARTICLES > 0 && MAX_PARTICLES < NO_SLOT, "slots must fit in uint16_t");
+    uint16_t* _active;
+    uint16_t* _link;
+    int _freeHead;
+    
+    // Reset both lists: no live slots, every slot free
+    void resetLists();
     
     // Initialize a particle with random properties
-    void initParticle(Particle& p, fixed_t x, fixed_t y);
+    void initParticle(int index, fixed_t x, fixed_t y);
 };
 
 // Global instance
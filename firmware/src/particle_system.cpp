@@ -3,11 +3,28 @@
  */
 
 #include "particle_system.h"
+#include "profiler.h"
 #include <math.h>
 
 // Global instance
 ParticleSystem particleSystem;
 
+// Quality ladder for the governor, full quality first. Fewer particles
+// and smaller sprites cut blend work; shorter trails let tiles go
+// black (and stop being faded and pushed) sooner.
+static const QualityLevel QUALITY_LEVELS[QUALITY_LEVEL_COUNT] = {
+    { MAX_PARTICLES, 2, (uint8_t)(FADE_FACTOR * 256) },
+    { 300,           2, 228 },
+    { 220,           1, 224 },
+    { 160,           1, 212 },
+    { 100,           0, 200 },
+};
+
+// Fixed physics step. Velocities are in pixels per 1/30 s and DAMPING
+// applies per 1/30 s, so other rates scale both to match.
+static const uint32_t PHYSICS_STEP_US = 1000000 / PHYSICS_HZ;
+static const float PHYSICS_STEP_SCALE = 30.0f / PHYSICS_HZ;
+
 // ============================================
 // Constructor
 // ============================================
@@ -27,11 +44,21 @@ ParticleSystem::ParticleSystem()
     , _targetArousal(0.3f)
     , _currentColor(0x07FF)  // Cyan
     , _noiseTime(0)
+    , _stepAccumUs(0)
+    , _renderAlpha(0)
+    , _gridValid(false)
     , _targetParticleCount(DEFAULT_PARTICLE_COUNT)
+    , _tableFormation(FORMATION_IDLE)
+    , _tableCount(0)
     , _lastFrameTime(0)
     , _fps(0)
     , _frameCount(0)
-    , _fpsUpdateTime(0) {
+    , _fpsUpdateTime(0)
+    , _qualityLevel(0)
+    , _frameStartUs(0)
+    , _frameTimeAvgUs(0)
+    , _overFrames(0)
+    , _underFrames(0) {
 }
 
 // ============================================
@@ -45,6 +72,9 @@ bool ParticleSystem::init(Arduino_GFX* gfx) {
     
     // Initialize noise
     noise_init(esp_random());
+#ifdef NOISE_FLOW_FIELD
+    _flowField.fill((uint32_t)_noiseTime);
+#endif
     Serial.println("  Noise initialized");
     
     // Generate particle sprites
@@ -62,7 +92,8 @@ bool ParticleSystem::init(Arduino_GFX* gfx) {
     // Connect sprites to framebuffer
     _framebuffer.setParticleSprites(
         particleSprites.getSpriteArray(),
-        particleSprites.getSizesArray()
+        particleSprites.getSizesArray(),
+        particleSprites.getSpansArray()
     );
     
     // Initialize particle pool
@@ -100,6 +131,36 @@ bool ParticleSystem::init(Arduino_GFX* gfx) {
 void ParticleSystem::update(float dt) {
     if (!_ready) return;
     
+    // Frame time (for the governor) runs to the end of render()
+    _frameStartUs = micros();
+    
+    // Run whole steps for the elapsed time. Past PHYSICS_MAX_STEPS the
+    // backlog is dropped, so a stall slows motion instead of piling up
+    // steps that would stall the next frame too
+    _stepAccumUs += (uint32_t)(dt * 1000000.0f + 0.5f);
+    int steps = 0;
+    while (_stepAccumUs >= PHYSICS_STEP_US) {
+        if (steps == PHYSICS_MAX_STEPS) {
+            _stepAccumUs %= PHYSICS_STEP_US;
+            break;
+        }
+        step(PHYSICS_STEP_US / 1000000.0f);
+        _stepAccumUs -= PHYSICS_STEP_US;
+        steps++;
+    }
+    _renderAlpha = (fixed_t)(((uint64_t)_stepAccumUs << FIXED_SHIFT) / PHYSICS_STEP_US);
+    
+    // Update FPS counter
+    _frameCount++;
+    unsigned long now = millis();
+    if (now - _fpsUpdateTime >= 1000) {
+        _fps = _frameCount * 1000.0f / (now - _fpsUpdateTime);
+        _frameCount = 0;
+        _fpsUpdateTime = now;
+    }
+}
+
+void ParticleSystem::step(float dt) {
     // Update noise time
     _noiseTime += FLOAT_TO_FIXED(dt * NOISE_TIME_SPEED);
     
@@ -122,120 +183,84 @@ void ParticleSystem::update(float dt) {
     // Update particle fades
     particlePool.updateFades(dt);
     
-    // Update physics for each particle
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        Particle& p = particlePool.get(i);
-        if (p.state == PARTICLE_INACTIVE) continue;
-        
-        updateParticlePhysics(p, dt);
-    }
-    
-    // Update FPS counter
-    _frameCount++;
-    unsigned long now = millis();
-    if (now - _fpsUpdateTime >= 1000) {
-        _fps = _frameCount * 1000.0f / (now - _fpsUpdateTime);
-        _frameCount = 0;
-        _fpsUpdateTime = now;
-    }
+    // Update physics: noise forces, then the fused integrate pass
+    applyNoise(dt);
+    integrateParticles(dt);
+    _gridValid = false;
 }
 
-void ParticleSystem::updateParticlePhysics(Particle& p, float dt) {
-    // Apply noise-based wandering
-    applyNoise(p, dt);
-    
-    // Apply formation attraction if particle has target
-    if (p.hasTarget) {
-        applyFormationAttraction(p, dt);
-    }
-    
-    // Apply soft center attraction
-    applyCenterAttraction(p, dt);
-    
-    // Apply damping
-    applyDamping(p);
-    
-    // Clamp velocity
-    clampVelocity(p);
-    
-    // Integrate position
-    integratePosition(p, dt);
-}
-
-void ParticleSystem::applyNoise(Particle& p, float dt) {
-    // Sample noise at particle's offset position
-    uint32_t nx = (uint32_t)(p.x + p.noiseOffsetX);
-    uint32_t ny = (uint32_t)(p.y + p.noiseOffsetY);
+void ParticleSystem::applyNoise(float dt) {
+    PROFILE_SCOPE(PROFILE_NOISE);
+    ParticleArrays& p = particlePool.arrays();
     uint32_t nt = (uint32_t)_noiseTime;
     
-    // Scale coordinates for appropriate noise frequency
-    uint32_t scaledX = (uint64_t)nx * (uint32_t)(NOISE_SCALE * 65536) >> 16;
-    uint32_t scaledY = (uint64_t)ny * (uint32_t)(NOISE_SCALE * 65536) >> 16;
-    
-    // Get curl noise for divergence-free flow
-    fixed_t noiseVX, noiseVY;
-    curl_noise_2d(scaledX, scaledY, nt, &noiseVX, &noiseVY);
-    
     // Scale and apply to velocity
     fixed_t strength = FLOAT_TO_FIXED(WANDER_STRENGTH * dt);
-    p.vx += fixed_mul(noiseVX, strength);
-    p.vy += fixed_mul(noiseVY, strength);
+    
+    const uint16_t* active = particlePool.activeList();
+    int count = particlePool.getActiveCount();
+    
+#ifdef NOISE_FLOW_FIELD
+    // Advance a slice of the cached field, then interpolate it
+    _flowField.update(nt);
+    
+    for (int k = 0; k < count; k++) {
+        int i = active[k];
+        
+        fixed_t noiseVX, noiseVY;
+        _flowField.sample(p.x[i], p.y[i], noiseVX, noiseVY);
+        
+        p.vx[i] += fixed_mul(noiseVX, strength);
+        p.vy[i] += fixed_mul(noiseVY, strength);
+    }
+#else
+    for (int k = 0; k < count; k++) {
+        int i = active[k];
+        
+        // Sample noise at particle's offset position
+        uint32_t nx = (uint32_t)(p.x[i] + p.noiseOffsetX[i]);
+        uint32_t ny = (uint32_t)(p.y[i] + p.noiseOffsetY[i]);
+        
+        // Scale coordinates for appropriate noise frequency
+        uint32_t scaledX = (uint64_t)nx * (uint32_t)(NOISE_SCALE * 65536) >> 16;
+        uint32_t scaledY = (uint64_t)ny * (uint32_t)(NOISE_SCALE * 65536) >> 16;
+        
+        // Get curl noise for divergence-free flow
+        fixed_t noiseVX, noiseVY;
+        curl_noise_2d(scaledX, scaledY, nt, &noiseVX, &noiseVY);
+        
+        p.vx[i] += fixed_mul(noiseVX, strength);
+        p.vy[i] += fixed_mul(noiseVY, strength);
+    }
+#endif
 }
 
-void ParticleSystem::applyFormationAttraction(Particle& p, float dt) {
-    if (!p.hasTarget) return;
+void ParticleSystem::integrateParticles(float dt) {
+    PROFILE_SCOPE(PROFILE_PHYSICS);
+    ParticleArrays& p = particlePool.arrays();
     
-    // Vector to target
-    fixed_t dx = p.targetX - p.x;
-    fixed_t dy = p.targetY - p.y;
+    // Per-frame constants, hoisted out of the particle loop
     
-    // Spring force
+    // Formation spring, blended by transition progress and tightness
     fixed_t spring = FLOAT_TO_FIXED(SPRING_K * dt);
-    
-    // Blend based on transition progress and formation tightness
     float blend = _transitionProgress * FORMATION_TIGHTNESS;
     spring = fixed_mul(spring, FLOAT_TO_FIXED(blend));
     
-    p.vx += fixed_mul(dx, spring);
-    p.vy += fixed_mul(dy, spring);
-}
-
-void ParticleSystem::applyCenterAttraction(Particle& p, float dt) {
     // Soft pull toward screen center to prevent drift
+    // (weaker if the particle has a formation target)
     fixed_t centerX = INT_TO_FIXED(SCREEN_CENTER_X);
     fixed_t centerY = INT_TO_FIXED(SCREEN_CENTER_Y);
+    fixed_t pull[2] = {
+        FLOAT_TO_FIXED(CENTER_PULL * dt),
+        FLOAT_TO_FIXED(CENTER_PULL * 0.3f * dt)
+    };
     
-    fixed_t dx = centerX - p.x;
-    fixed_t dy = centerY - p.y;
-    
-    // Weaker if has formation target
-    float pullStrength = p.hasTarget ? CENTER_PULL * 0.3f : CENTER_PULL;
-    fixed_t pull = FLOAT_TO_FIXED(pullStrength * dt);
-    
-    p.vx += fixed_mul(dx, pull);
-    p.vy += fixed_mul(dy, pull);
-}
-
-void ParticleSystem::applyDamping(Particle& p) {
-    // Velocity damping for smooth motion
-    fixed_t damping = FLOAT_TO_FIXED(DAMPING);
-    p.vx = fixed_mul(p.vx, damping);
-    p.vy = fixed_mul(p.vy, damping);
-}
-
-void ParticleSystem::clampVelocity(Particle& p) {
-    // Prevent particles from moving too fast
+    // Velocity damping for smooth motion, and the speed limit
+    fixed_t damping = FLOAT_TO_FIXED(powf(DAMPING, PHYSICS_STEP_SCALE));
     fixed_t maxV = FLOAT_TO_FIXED(MAX_VELOCITY);
     
-    if (p.vx > maxV) p.vx = maxV;
-    if (p.vx < -maxV) p.vx = -maxV;
-    if (p.vy > maxV) p.vy = maxV;
-    if (p.vy < -maxV) p.vy = -maxV;
-}
-
-void ParticleSystem::integratePosition(Particle& p, float dt) {
-    p.x += p.vx;
-    p.y += p.vy;
+    // Position change per unit of velocity this step
+    fixed_t stepScale = FLOAT_TO_FIXED(PHYSICS_STEP_SCALE);
     
     // Soft boundary wrapping (particles wrap around screen edges)
     int margin = 30;
@@ -244,10 +269,59 @@ void ParticleSystem::integratePosition(Particle& p, float dt) {
     fixed_t minY = INT_TO_FIXED(-margin);
     fixed_t maxY = INT_TO_FIXED(SCREEN_HEIGHT + margin);
     
-    if (p.x < minX) p.x = maxX - FIXED_ONE;
-    if (p.x > maxX) p.x = minX + FIXED_ONE;
-    if (p.y < minY) p.y = maxY - FIXED_ONE;
-    if (p.y > maxY) p.y = minY + FIXED_ONE;
+    const uint16_t* active = particlePool.activeList();
+    int count = particlePool.getActiveCount();
+    
+    for (int k = 0; k < count; k++) {
+        int i = active[k];
+        
+        fixed_t x = p.x[i];
+        fixed_t y = p.y[i];
+        fixed_t vx = p.vx[i];
+        fixed_t vy = p.vy[i];
+        uint8_t hasTarget = p.hasTarget[i];
+        
+        // Formation attraction; spring is masked to zero without a target
+        fixed_t attract = spring & -(fixed_t)hasTarget;
+        vx += fixed_mul(p.targetX[i] - x, attract);
+        vy += fixed_mul(p.targetY[i] - y, attract);
+        
+        // Center attraction
+        vx += fixed_mul(centerX - x, pull[hasTarget]);
+        vy += fixed_mul(centerY - y, pull[hasTarget]);
+        
+        // Damping, then clamp velocity
+        vx = fixed_mul(vx, damping);
+        vy = fixed_mul(vy, damping);
+        vx = constrain(vx, -maxV, maxV);
+        vy = constrain(vy, -maxV, maxV);
+        
+        // Integrate position and wrap
+        fixed_t prevX = x;
+        fixed_t prevY = y;
+        x += fixed_mul(vx, stepScale);
+        y += fixed_mul(vy, stepScale);
+        fixed_t movedX = x;
+        fixed_t movedY = y;
+        x = (x < minX) ? maxX - FIXED_ONE : x;
+        x = (x > maxX) ? minX + FIXED_ONE : x;
+        y = (y < minY) ? maxY - FIXED_ONE : y;
+        y = (y > maxY) ? minY + FIXED_ONE : y;
+        
+        // A wrapped particle jumps to the far edge; don't interpolate
+        // it across the screen
+        if (x != movedX || y != movedY) {
+            prevX = x;
+            prevY = y;
+        }
+        
+        p.prevX[i] = prevX;
+        p.prevY[i] = prevY;
+        p.x[i] = x;
+        p.y[i] = y;
+        p.vx[i] = vx;
+        p.vy[i] = vy;
+    }
 }
 
 // ============================================
@@ -270,6 +344,7 @@ void ParticleSystem::clearFormation(uint16_t transitionMs) {
 }
 
 void ParticleSystem::updateFormationTargets() {
+    PROFILE_SCOPE(PROFILE_FORMATION);
     int activeCount = particlePool.getActiveCount();
     if (activeCount == 0) return;
     
@@ -279,28 +354,34 @@ void ParticleSystem::updateFormationTargets() {
         return;
     }
     
+    // Float trig runs only when the formation or count changes
+    if (_tableFormation != _targetFormation || _tableCount != activeCount) {
+        buildFormationTable(_targetFormation, activeCount);
+    }
+    
     // Assign formation targets to particles
-    int targetIdx = 0;
-    for (int i = 0; i < MAX_PARTICLES && targetIdx < activeCount; i++) {
-        Particle& p = particlePool.get(i);
-        if (p.state == PARTICLE_INACTIVE) continue;
-        
-        fixed_t tx, ty;
-        getFormationPoint(_targetFormation, targetIdx, activeCount, tx, ty);
+    ParticleArrays& p = particlePool.arrays();
+    const uint16_t* active = particlePool.activeList();
+    for (int targetIdx = 0; targetIdx < activeCount; targetIdx++) {
+        int i = active[targetIdx];
         
-        p.targetX = tx;
-        p.targetY = ty;
-        p.hasTarget = true;
-        
-        targetIdx++;
+        p.targetX[i] = _tableX[targetIdx];
+        p.targetY[i] = _tableY[targetIdx];
+        p.hasTarget[i] = 1;
     }
 }
 
-void ParticleSystem::clearAllTargets() {
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        Particle& p = particlePool.get(i);
-        p.hasTarget = false;
+void ParticleSystem::buildFormationTable(FormationType formation, int total) {
+    for (int idx = 0; idx < total; idx++) {
+        getFormationPoint(formation, idx, total, _tableX[idx], _tableY[idx]);
     }
+    
+    _tableFormation = formation;
+    _tableCount = total;
+}
+
+void ParticleSystem::clearAllTargets() {
+    memset(particlePool.arrays().hasTarget, 0, MAX_PARTICLES);
 }
 
 void ParticleSystem::getFormationPoint(FormationType formation, int index, int total,
@@ -489,7 +570,7 @@ void ParticleSystem::setParticleCount(int count) {
 
 void ParticleSystem::adjustParticleCount(float dt) {
     int current = particlePool.getActiveCount();
-    int target = _targetParticleCount;
+    int target = min(_targetParticleCount, (int)QUALITY_LEVELS[_qualityLevel].maxParticles);
     
     if (current < target) {
         // Spawn new particles
@@ -501,9 +582,11 @@ void ParticleSystem::adjustParticleCount(float dt) {
         // Fade out excess particles
         int toRemove = min(5, current - target);
         int removed = 0;
-        for (int i = MAX_PARTICLES - 1; i >= 0 && removed < toRemove; i--) {
-            Particle& p = particlePool.get(i);
-            if (p.state == PARTICLE_ACTIVE) {
+        const uint8_t* state = particlePool.arrays().state;
+        const uint16_t* active = particlePool.activeList();
+        for (int k = current - 1; k >= 0 && removed < toRemove; k--) {
+            int i = active[k];
+            if (state[i] == PARTICLE_ACTIVE) {
                 particlePool.startFadeOut(i);
                 removed++;
             }
@@ -511,6 +594,48 @@ void ParticleSystem::adjustParticleCount(float dt) {
     }
 }
 
+// ============================================
+// Quality Governor
+// ============================================
+
+const QualityLevel& ParticleSystem::getQualityLevelInfo(uint8_t level) {
+    return QUALITY_LEVELS[min(level, (uint8_t)(QUALITY_LEVEL_COUNT - 1))];
+}
+
+void ParticleSystem::updateQuality(uint32_t frameUs) {
+    // Rolling average over roughly the last 8 frames
+    _frameTimeAvgUs += ((int32_t)frameUs - (int32_t)_frameTimeAvgUs) / 8;
+    
+    const uint32_t budget = TARGET_FRAME_TIME_MS * 1000UL;
+    
+    if (_frameTimeAvgUs > budget) {
+        // Missing the budget: shed a level once it persists
+        _underFrames = 0;
+        if (_qualityLevel < QUALITY_LEVEL_COUNT - 1 && ++_overFrames >= QUALITY_DROP_FRAMES) {
+            setQualityLevel(_qualityLevel + 1);
+        }
+    } else if (_frameTimeAvgUs < budget * QUALITY_RAISE_PERCENT / 100) {
+        // Clear headroom: restore a level after a longer stretch
+        _overFrames = 0;
+        if (_qualityLevel > 0 && ++_underFrames >= QUALITY_RAISE_FRAMES) {
+            setQualityLevel(_qualityLevel - 1);
+        }
+    } else {
+        _overFrames = 0;
+        _underFrames = 0;
+    }
+}
+
+void ParticleSystem::setQualityLevel(uint8_t level) {
+    _qualityLevel = level;
+    _overFrames = 0;
+    _underFrames = 0;
+    
+    const QualityLevel& q = QUALITY_LEVELS[level];
+    Serial.printf("Quality level %u (%.1f ms/frame): %u particles, size <= %u, fade %u\n",
+                  level, getFrameTimeMs(), q.maxParticles, q.maxSizeIdx, q.fade256);
+}
+
 // ============================================
 // Touch Interaction
 // ============================================
@@ -519,18 +644,22 @@ void ParticleSystem::onTouch(int16_t x, int16_t y) {
     // Particles scatter from touch point
     fixed_t touchX = INT_TO_FIXED(x);
     fixed_t touchY = INT_TO_FIXED(y);
+    const fixed_t radius = INT_TO_FIXED(100);  // 100 pixel radius
     
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        Particle& p = particlePool.get(i);
-        if (p.state == PARTICLE_INACTIVE) continue;
+    if (!_gridValid) buildGrid();
+    
+    // Only particles in grid cells near the touch are tested
+    ParticleArrays& p = particlePool.arrays();
+    _grid.query(touchX, touchY, radius, [&](uint16_t i) {
+        fixed_t dx = p.x[i] - touchX;
+        fixed_t dy = p.y[i] - touchY;
         
-        fixed_t dx = p.x - touchX;
-        fixed_t dy = p.y - touchY;
+        // Box test first, so the squared distance fits in 16.16
+        if (fixed_abs(dx) >= radius || fixed_abs(dy) >= radius) return;
         fixed_t distSq = fixed_mul(dx, dx) + fixed_mul(dy, dy);
         
         // Affect particles within radius
-        fixed_t radiusSq = INT_TO_FIXED(100 * 100);  // 100 pixel radius
-        if (distSq < radiusSq && distSq > FIXED_ONE) {
+        if (distSq < fixed_mul(radius, radius) && distSq > FIXED_ONE) {
             fixed_t dist = fixed_sqrt(distSq);
             
             // Normalize direction
@@ -540,10 +669,24 @@ void ParticleSystem::onTouch(int16_t x, int16_t y) {
             // Push force inversely proportional to distance
             fixed_t force = fixed_div(INT_TO_FIXED(5), dist / FIXED_ONE + FIXED_ONE);
             
-            p.vx += fixed_mul(nx, force);
-            p.vy += fixed_mul(ny, force);
+            p.vx[i] += fixed_mul(nx, force);
+            p.vy[i] += fixed_mul(ny, force);
         }
+    });
+}
+
+void ParticleSystem::buildGrid() {
+    const ParticleArrays& p = particlePool.arrays();
+    const uint16_t* active = particlePool.activeList();
+    int count = particlePool.getActiveCount();
+    
+    _grid.clear();
+    for (int k = 0; k < count; k++) {
+        int i = active[k];
+        _grid.insert(i, p.x[i], p.y[i]);
     }
+    _grid.finalize();
+    _gridValid = true;
 }
 
 // ============================================
@@ -553,35 +696,54 @@ void ParticleSystem::onTouch(int16_t x, int16_t y) {
 void ParticleSystem::render() {
     if (!_ready) return;
     
+#ifdef FB_INTENSITY_RENDER
+    // One color for the whole frame, applied as it is pushed
+    _framebuffer.setTint(_currentColor);
+#endif
+    
     // Fade existing content (creates trails)
-    _framebuffer.fadeFast((uint8_t)(FADE_FACTOR * 256));
+    _framebuffer.fadeFast(QUALITY_LEVELS[_qualityLevel].fade256);
     
     // Render all active particles
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        Particle& p = particlePool.get(i);
-        if (p.state == PARTICLE_INACTIVE) continue;
-        
-        renderParticle(p);
+    PROFILE_START(raster);
+    const uint16_t* active = particlePool.activeList();
+    int count = particlePool.getActiveCount();
+    for (int k = 0; k < count; k++) {
+        renderParticle(active[k]);
     }
+    PROFILE_LAP(PROFILE_RASTER, raster);
     
     // Push to display
     _framebuffer.pushToDisplay();
+    
+#ifdef QUALITY_GOVERNOR
+    updateQuality(micros() - _frameStartUs);
+#endif
 }
 
-void ParticleSystem::renderParticle(const Particle& p) {
-    int16_t x = FIXED_TO_INT(p.x);
-    int16_t y = FIXED_TO_INT(p.y);
+void ParticleSystem::renderParticle(int i) {
+    const ParticleArrays& p = particlePool.arrays();
+    
+    // Between the last two physics steps
+    fixed_t fx = p.prevX[i] + fixed_mul(p.x[i] - p.prevX[i], _renderAlpha);
+    fixed_t fy = p.prevY[i] + fixed_mul(p.y[i] - p.prevY[i], _renderAlpha);
+    int16_t x = FIXED_TO_INT(fx);
+    int16_t y = FIXED_TO_INT(fy);
     
     // Calculate effective brightness
-    uint8_t brightness = p.brightness;
+    uint8_t brightness = p.brightness[i];
     
     // Apply fade progress
-    if (p.state == PARTICLE_FADING_IN || p.state == PARTICLE_FADING_OUT) {
-        brightness = (brightness * p.fadeProgress) >> 8;
+    if (p.state[i] == PARTICLE_FADING_IN || p.state[i] == PARTICLE_FADING_OUT) {
+        brightness = (brightness * p.fadeProgress[i]) >> 8;
     }
     
-    // Draw soft particle
-    _framebuffer.drawSoftParticle(x, y, p.sizeIdx, _currentColor, brightness);
+    // Lower quality levels draw large particles with smaller sprites
+    uint8_t sizeIdx = min(p.sizeIdx[i], QUALITY_LEVELS[_qualityLevel].maxSizeIdx);
+    
+    // Draw soft particle, picking the variant for the sub-pixel offset
+    _framebuffer.drawSoftParticle(x, y, sizeIdx, _currentColor, brightness,
+                                  spritePhase(fx, fy));
 }
 
 int ParticleSystem::getActiveParticles() const {
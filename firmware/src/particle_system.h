@@ -11,7 +11,9 @@
 #include <Arduino.h>
 #include "fixed_math.h"
 #include "noise.h"
+#include "flow_field.h"
 #include "particle.h"
+#include "spatial_grid.h"
 #include "framebuffer.h"
 #include "sprites.h"
 #include "../config.h"
@@ -44,6 +46,22 @@ enum SystemState : uint8_t {
     STATE_DISCONNECTED       // No server connection
 };
 
+// ============================================
+// Quality Levels
+// ============================================
+
+/**
+ * One step of the quality governor's ladder (level 0 = full quality,
+ * each later level sheds more load).
+ */
+struct QualityLevel {
+    uint16_t maxParticles;  // Cap on the particle count
+    uint8_t maxSizeIdx;     // Largest sprite drawn (0=small, 2=large)
+    uint8_t fade256;        // Trail fade factor (lower = shorter trails)
+};
+
+#define QUALITY_LEVEL_COUNT 5
+
 // ============================================
 // Particle System Class
 // ============================================
@@ -60,7 +78,9 @@ public:
     bool init(Arduino_GFX* gfx);
     
     /**
-     * Update physics and state.
+     * Advance the simulation by the frame's elapsed time, in fixed
+     * steps of 1/PHYSICS_HZ (see config.h). Leftover time sets how far
+     * render() interpolates between the last two steps.
      * @param dt Delta time in seconds
      */
     void update(float dt);
@@ -104,11 +124,34 @@ public:
      */
     void onTouch(int16_t x, int16_t y);
     
+    /**
+     * Wait for any in-flight display transfer (before other bus use).
+     */
+    void waitForDisplay() { _framebuffer.waitForPush(); }
+    
+    /**
+     * Get a level of the quality ladder.
+     * @param level 0 (full) to QUALITY_LEVEL_COUNT - 1
+     */
+    static const QualityLevel& getQualityLevelInfo(uint8_t level);
+    
+    /**
+     * Current quality level. A single byte, so other tasks may poll it.
+     */
+    uint8_t getQualityLevel() const { return _qualityLevel; }
+    
+    /**
+     * Rolling average of update + render time, in milliseconds.
+     */
+    float getFrameTimeMs() const { return _frameTimeAvgUs / 1000.0f; }
+    
     // Accessors
     FormationType getCurrentFormation() const { return _currentFormation; }
     SystemState getState() const { return _state; }
     int getActiveParticles() const;
     float getFPS() const { return _fps; }
+    uint32_t getBytesPushed() const { return _framebuffer.getBytesPushed(); }
+    uint16_t getLiveTiles() const { return _framebuffer.getLiveTiles(); }
     bool isReady() const { return _ready; }
 
 private:
@@ -139,31 +182,57 @@ private:
     // Physics time
     fixed_t _noiseTime;
     
+    // Time not yet simulated (under one step), and the same as a
+    // fraction of a step for render interpolation
+    uint32_t _stepAccumUs;
+    fixed_t _renderAlpha;
+    
+#ifdef NOISE_FLOW_FIELD
+    // Cached curl noise, sampled by applyNoise()
+    FlowField _flowField;
+#endif
+    
+    // Particle positions bucketed for neighbor queries; rebuilt on
+    // first use after each physics step
+    SpatialGrid<MAX_PARTICLES> _grid;
+    bool _gridValid;
+    
     // Target particle count
     int _targetParticleCount;
     
+    // Formation points for (_tableFormation, _tableCount), indexed by
+    // position in the active list; rebuilt only when either changes
+    fixed_t _tableX[MAX_PARTICLES];
+    fixed_t _tableY[MAX_PARTICLES];
+    FormationType _tableFormation;
+    int _tableCount;
+    
     // Performance tracking
     unsigned long _lastFrameTime;
     float _fps;
     int _frameCount;
     unsigned long _fpsUpdateTime;
     
+    // Quality governor: level in use, and the frame time it watches
+    volatile uint8_t _qualityLevel;
+    uint32_t _frameStartUs;
+    uint32_t _frameTimeAvgUs;
+    uint16_t _overFrames;       // Consecutive frames over budget
+    uint16_t _underFrames;      // Consecutive frames with headroom
+    
     // ============================================
     // Internal Methods
     // ============================================
     
-    // Physics update
-    void updateParticlePhysics(Particle& p, float dt);
-    void applyNoise(Particle& p, float dt);
-    void applyFormationAttraction(Particle& p, float dt);
-    void applyCenterAttraction(Particle& p, float dt);
-    void applyDamping(Particle& p);
-    void clampVelocity(Particle& p);
-    void integratePosition(Particle& p, float dt);
+    // One fixed physics step, and its passes over the particle arrays
+    void step(float dt);
+    void applyNoise(float dt);
+    void integrateParticles(float dt);
     
     // Formation management
     void updateFormationTargets();
     void clearAllTargets();
+    void buildFormationTable(FormationType formation, int total);
     void getFormationPoint(FormationType formation, int index, int total,
                           fixed_t& outX, fixed_t& outY);
     
@@ -174,8 +243,15 @@ private:
     // Particle count management
     void adjustParticleCount(float dt);
     
+    // Quality governor
+    void updateQuality(uint32_t frameUs);
+    void setQualityLevel(uint8_t level);
+    
+    // Neighbor queries
+    void buildGrid();
+    
     // Rendering
-    void renderParticle(const Particle& p);
+    void renderParticle(int i);
 };
 
 // Global instance
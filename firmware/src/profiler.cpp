@@ -0,0 +1,71 @@
+/**
+ * Ada Particles - Hot-Path Profiler Implementation
+ */
+
+#include "profiler.h"
+
+#ifdef DEBUG_ENABLED
+
+#include <algorithm>
+
+// Global instance
+Profiler profiler;
+
+static const char* const STAGE_NAMES[PROFILE_STAGE_COUNT] = {
+    "ws_poll", "json", "image", "noise", "physics", "formation", "fade", "raster", "push"
+};
+
+Profiler::Profiler() {
+    memset(_samples, 0, sizeof(_samples));
+    memset(_head, 0, sizeof(_head));
+    memset(_count, 0, sizeof(_count));
+    memset(_pending, 0, sizeof(_pending));
+    memset(_pendingHits, 0, sizeof(_pendingHits));
+}
+
+void Profiler::commit(uint8_t first, uint8_t last) {
+    for (uint8_t s = first; s <= last; s++) {
+        if (!_pendingHits[s]) continue;
+        
+        _samples[s][_head[s]] = _pending[s];
+        _head[s] = (_head[s] + 1) & (PROFILE_SAMPLES - 1);
+        if (_count[s] < PROFILE_SAMPLES) _count[s]++;
+        
+        _pending[s] = 0;
+        _pendingHits[s] = 0;
+    }
+}
+
+bool Profiler::getStats(uint8_t stage, ProfileStats& out) const {
+    uint16_t count = _count[stage];
+    if (count == 0) return false;
+    
+    // Copy the window, so p99 can partially sort it
+    uint32_t window[PROFILE_SAMPLES];
+    memcpy(window, _samples[stage], count * sizeof(uint32_t));
+    
+    uint32_t lo = window[0], hi = window[0];
+    uint64_t sum = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        lo = min(lo, window[i]);
+        hi = max(hi, window[i]);
+        sum += window[i];
+    }
+    
+    uint16_t rank = min((uint16_t)(count - 1), (uint16_t)((count * 99) / 100));
+    std::nth_element(window, window + rank, window + count);
+    
+    uint32_t mhz = ESP.getCpuFreqMHz();
+    out.count = count;
+    out.minUs = lo / mhz;
+    out.avgUs = (uint32_t)(sum / count / mhz);
+    out.p99Us = window[rank] / mhz;
+    out.maxUs = hi / mhz;
+    return true;
+}
+
+const char* Profiler::stageName(uint8_t stage) {
+    return stage < PROFILE_STAGE_COUNT ? STAGE_NAMES[stage] : "?";
+}
+
+#endif // DEBUG_ENABLED
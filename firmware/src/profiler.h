@@ -0,0 +1,154 @@
+/**
+ * Ada Particles - Hot-Path Profiler
+ *
+ * Scoped timers on the CPU cycle counter around each pipeline stage.
+ * Time spent in a stage accumulates until the owning task commits it
+ * (once per frame for render stages, once per poll for network
+ * stages), so a stage that runs several times a frame - physics
+ * substeps, per-band fades - still yields one sample per frame.
+ * Each stage keeps its last PROFILE_SAMPLES samples in a ring, and
+ * getStats() reduces them to min / avg / p99 / max.
+ *
+ * Every stage is written by a single task; stats may be read from
+ * another, and at worst see a sample being replaced.
+ *
+ * Without DEBUG_ENABLED the macros expand to nothing.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include "../config.h"
+
+// ============================================
+// Stages
+// ============================================
+
+enum ProfileStage : uint8_t {
+    // Network task (ws poll includes the message handlers below it)
+    PROFILE_WS_POLL = 0,
+    PROFILE_JSON_PARSE,
+    PROFILE_IMAGE_INGEST,
+
+    // Render task
+    PROFILE_NOISE,
+    PROFILE_PHYSICS,
+    PROFILE_FORMATION,
+    PROFILE_FADE,
+    PROFILE_RASTER,
+    PROFILE_PUSH,
+
+    PROFILE_STAGE_COUNT
+};
+
+#define PROFILE_NETWORK_FIRST PROFILE_WS_POLL
+#define PROFILE_NETWORK_LAST PROFILE_IMAGE_INGEST
+#define PROFILE_RENDER_FIRST PROFILE_NOISE
+#define PROFILE_RENDER_LAST PROFILE_PUSH
+
+/**
+ * Reduced samples of one stage, in microseconds.
+ */
+struct ProfileStats {
+    uint16_t count;     // Samples in the window
+    uint32_t minUs;
+    uint32_t avgUs;
+    uint32_t p99Us;
+    uint32_t maxUs;
+};
+
+#ifdef DEBUG_ENABLED
+
+static_assert((PROFILE_SAMPLES & (PROFILE_SAMPLES - 1)) == 0, "PROFILE_SAMPLES must be a power of two");
+
+// ============================================
+// Profiler
+// ============================================
+
+class Profiler {
+public:
+    Profiler();
+
+    /**
+     * Add cycles to a stage's pending sample.
+     */
+    void add(uint8_t stage, uint32_t cycles) {
+        _pending[stage] += cycles;
+        _pendingHits[stage] = 1;
+    }
+
+    /**
+     * Add the cycles since start to a stage and restart from now.
+     */
+    void lap(uint8_t stage, uint32_t& start) {
+        uint32_t now = ESP.getCycleCount();
+        add(stage, now - start);
+        start = now;
+    }
+
+    /**
+     * Close the pending samples of stages first..last (one task's
+     * stages) into their rings. Stages that did not run are skipped.
+     */
+    void commit(uint8_t first, uint8_t last);
+
+    /**
+     * Reduce a stage's window.
+     * @return false if the stage has no samples yet
+     */
+    bool getStats(uint8_t stage, ProfileStats& out) const;
+
+    /**
+     * Short stage name for reports ("noise", "push", ...).
+     */
+    static const char* stageName(uint8_t stage);
+
+private:
+    uint32_t _samples[PROFILE_STAGE_COUNT][PROFILE_SAMPLES];  // Cycles
+    uint16_t _head[PROFILE_STAGE_COUNT];
+    uint16_t _count[PROFILE_STAGE_COUNT];
+    uint32_t _pending[PROFILE_STAGE_COUNT];
+    uint8_t _pendingHits[PROFILE_STAGE_COUNT];
+};
+
+// Global instance
+extern Profiler profiler;
+
+/**
+ * Adds the cycles between construction and destruction to a stage.
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(uint8_t stage) : _stage(stage), _start(ESP.getCycleCount()) {}
+    ~ProfileScope() { profiler.add(_stage, ESP.getCycleCount() - _start); }
+
+private:
+    uint8_t _stage;
+    uint32_t _start;
+};
+
+#define PROFILE_JOIN2(a, b) a##b
+#define PROFILE_JOIN(a, b) PROFILE_JOIN2(a, b)
+
+// Time the rest of the enclosing block
+#define PROFILE_SCOPE(stage) ProfileScope PROFILE_JOIN(_profileScope, __LINE__)(stage)
+
+// Time consecutive spans: PROFILE_START(t), then PROFILE_LAP(stage, t)
+// at the end of each span
+#define PROFILE_START(t) uint32_t t = ESP.getCycleCount()
+#define PROFILE_LAP(stage, t) profiler.lap(stage, t)
+
+// End a frame (or poll) for one task's stages
+#define PROFILE_COMMIT(first, last) profiler.commit(first, last)
+
+#else
+
+#define PROFILE_SCOPE(stage)
+#define PROFILE_START(t)
+#define PROFILE_LAP(stage, t)
+#define PROFILE_COMMIT(first, last)
+
+#endif // DEBUG_ENABLED
+
+#endif // PROFILER_H
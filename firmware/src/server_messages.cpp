@@ -0,0 +1,101 @@
+/**
+ * Ada Particles - Server Message Translation Implementation
+ */
+
+#include "server_messages.h"
+#include <ArduinoJson.h>
+#include "particle_system.h"
+#include "profiler.h"
+#include "../image_frame.h"
+
+static bool parseImageFrame(const uint8_t* data, size_t len) {
+    // Binary image or delta frame: header + pixels, viewed in place
+    PROFILE_START(ingest);
+    ImageFrame frame;
+    bool valid = image_frame_parse(data, len, &frame);
+    PROFILE_LAP(PROFILE_IMAGE_INGEST, ingest);
+    if (!valid) {
+        DEBUG_PRINTLN("Invalid binary frame");
+        return false;
+    }
+    
+    // The sketch never consumes frames: the native engine draws no
+    // images, so a valid frame is only logged and then dropped. Only
+    // the image engine (particle_system.h) ingests them, through
+    // createFromFrame() and applyDelta()
+    DEBUG_PRINTF("Image frame #%u (type %u): %ux%u, format %u (not used in native mode)\n",
+                 (unsigned)frame.sequence, frame.type, frame.width, frame.height, frame.format);
+    return true;
+}
+
+bool parseServerMessage(const uint8_t* data, size_t len, bool binary,
+                        void (*emit)(const Command& cmd)) {
+    if (binary) {
+        return parseImageFrame(data, len);
+    }
+    
+    // Parse JSON state message
+    PROFILE_START(parse);
+    StaticJsonDocument<512> doc;
+    DeserializationError error = deserializeJson(doc, (const char*)data, len);
+    PROFILE_LAP(PROFILE_JSON_PARSE, parse);
+    
+    if (error) {
+        DEBUG_PRINTF("JSON parse error: %s\n", error.c_str());
+        return false;
+    }
+    
+    String msgType = doc["type"] | "";
+    
+    if (msgType == "state") {
+        Command cmd;
+        
+        // Mood update
+        if (doc.containsKey("mood")) {
+            cmd.type = CMD_SET_MOOD;
+            cmd.mood.valence = doc["mood"]["valence"] | 0.0f;
+            cmd.mood.arousal = doc["mood"]["arousal"] | 0.3f;
+            emit(cmd);
+        }
+        
+        // Formation update
+        if (doc.containsKey("formation")) {
+            String formation = doc["formation"] | "idle";
+            uint16_t transitionMs = doc["transition_ms"] | DEFAULT_TRANSITION_MS;
+            
+            FormationType ft = FORMATION_IDLE;
+            if (formation == "cloud") ft = FORMATION_CLOUD;
+            else if (formation == "sun") ft = FORMATION_SUN;
+            else if (formation == "rain") ft = FORMATION_RAIN;
+            else if (formation == "snow") ft = FORMATION_SNOW;
+            else if (formation == "heart") ft = FORMATION_HEART;
+            else if (formation == "thinking") ft = FORMATION_THINKING;
+            else if (formation == "wave") ft = FORMATION_WAVE;
+            
+            cmd.type = CMD_SET_FORMATION;
+            cmd.formation.type = ft;
+            cmd.formation.transitionMs = transitionMs;
+            emit(cmd);
+        }
+        
+        // Particle count
+        if (doc.containsKey("particle_count")) {
+            cmd.type = CMD_SET_PARTICLE_COUNT;
+            cmd.particleCount = doc["particle_count"] | DEFAULT_PARTICLE_COUNT;
+            emit(cmd);
+        }
+    } else if (msgType == "config") {
+        // Display brightness
+        if (doc.containsKey("brightness")) {
+            int brightness = doc["brightness"] | DISPLAY_BRIGHTNESS;
+            Command cmd;
+            cmd.type = CMD_SET_BRIGHTNESS;
+            cmd.brightness = constrain(brightness, 0, 255);
+            emit(cmd);
+        }
+    } else if (msgType == "pong") {
+        // Heartbeat response
+    }
+    
+    return true;
+}
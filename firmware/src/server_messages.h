@@ -0,0 +1,27 @@
+/**
+ * Ada Particles - Server Message Translation
+ *
+ * Turns one WebSocket message from the server (JSON text or a binary
+ * image frame) into render commands. Shared by the live socket, the
+ * message log replay and the host bench, so all three drive the
+ * particle system identically.
+ */
+
+#ifndef SERVER_MESSAGES_H
+#define SERVER_MESSAGES_H
+
+#include <Arduino.h>
+#include "command_queue.h"
+
+/**
+ * Translate a server message.
+ * @param data    Message bytes
+ * @param len     Message length
+ * @param binary  true for a binary (image frame) message
+ * @param emit    Called with each resulting command, in order
+ * @return false if the message could not be parsed
+ */
+bool parseServerMessage(const uint8_t* data, size_t len, bool binary,
+                        void (*emit)(const Command& cmd));
+
+#endif // SERVER_MESSAGES_H
@@ -0,0 +1,126 @@
+/**
+ * Ada Particles - Uniform Spatial Grid
+ *
+ * Buckets particle ids by screen cell for neighbor queries (links,
+ * touch). Rebuilt from scratch with a counting sort: insert() walks
+ * the positions once, recording each item's cell and counting cell
+ * sizes, and finalize() scatters the ids into per-cell runs. Queries
+ * then visit only the cells overlapping a search box.
+ *
+ * Positions off screen are clamped into the edge cells, so every
+ * inserted item can still be found.
+ */
+
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include <Arduino.h>
+#include "fixed_math.h"
+#include "../config.h"
+
+/**
+ * Grid over the screen with cells of 2^SPATIAL_GRID_CELL_SHIFT pixels,
+ * holding up to CAPACITY items (ids 0-65535).
+ */
+template <size_t CAPACITY>
+class SpatialGrid {
+    static_assert(CAPACITY > 0 && CAPACITY <= 0xFFFF, "items must be indexable by uint16_t");
+
+public:
+    static const int CELL_SHIFT = SPATIAL_GRID_CELL_SHIFT;
+    static const int COLS = (SCREEN_WIDTH >> CELL_SHIFT) + 1;
+    static const int ROWS = (SCREEN_HEIGHT >> CELL_SHIFT) + 1;
+
+    SpatialGrid() : _count(0) {
+        memset(_cellStart, 0, sizeof(_cellStart));
+    }
+
+    /**
+     * Start a rebuild (drops all items).
+     */
+    void clear() {
+        _count = 0;
+        memset(_cellStart, 0, sizeof(_cellStart));
+    }
+
+    /**
+     * Add an item at a screen position (16.16 fixed-point).
+     * @return false if the grid is full
+     */
+    bool insert(uint16_t id, fixed_t x, fixed_t y) {
+        if (_count >= CAPACITY) return false;
+
+        uint16_t cell = cellIndex(cellCol(x), cellRow(y));
+        _itemId[_count] = id;
+        _itemCell[_count] = cell;
+        _count++;
+        _cellStart[cell + 1]++;
+        return true;
+    }
+
+    /**
+     * Finish a rebuild: prefix-sum the cell counts and place the ids.
+     * Call after the last insert() and before any query.
+     */
+    void finalize() {
+        uint16_t cursor[COLS * ROWS];
+        for (int c = 0; c < COLS * ROWS; c++) {
+            _cellStart[c + 1] += _cellStart[c];
+            cursor[c] = _cellStart[c];
+        }
+
+        for (size_t n = 0; n < _count; n++) {
+            _ids[cursor[_itemCell[n]]++] = _itemId[n];
+        }
+    }
+
+    /**
+     * Call fn(id) for every item in the cells overlapping the square of
+     * half-width radius around (x, y). Items outside the radius are
+     * included; callers apply their own exact distance test.
+     */
+    template <typename Fn>
+    void query(fixed_t x, fixed_t y, fixed_t radius, Fn fn) const {
+        int col0 = cellCol(x - radius);
+        int col1 = cellCol(x + radius);
+        int row0 = cellRow(y - radius);
+        int row1 = cellRow(y + radius);
+
+        for (int row = row0; row <= row1; row++) {
+            // Cells of a row are contiguous, so scan the run in one go
+            uint16_t begin = _cellStart[cellIndex(col0, row)];
+            uint16_t end = _cellStart[cellIndex(col1, row) + 1];
+            for (uint16_t n = begin; n < end; n++) {
+                fn(_ids[n]);
+            }
+        }
+    }
+
+    /**
+     * Number of items in the grid.
+     */
+    size_t size() const { return _count; }
+
+private:
+    uint16_t _cellStart[COLS * ROWS + 1];   // Per cell, into _ids
+    uint16_t _ids[CAPACITY];                // Item ids, grouped by cell
+    uint16_t _itemId[CAPACITY];             // Insertion order
+    uint16_t _itemCell[CAPACITY];
+    size_t _count;
+
+    static int cellCol(fixed_t x) {
+        int col = FIXED_TO_INT(x) >> CELL_SHIFT;
+        return col < 0 ? 0 : (col >= COLS ? COLS - 1 : col);
+    }
+
+    static int cellRow(fixed_t y) {
+        int row = FIXED_TO_INT(y) >> CELL_SHIFT;
+        return row < 0 ? 0 : (row >= ROWS ? ROWS - 1 : row);
+    }
+
+    static uint16_t cellIndex(int col, int row) {
+        return (uint16_t)(row * COLS + col);
+    }
+};
+
+#endif // SPATIAL_GRID_H
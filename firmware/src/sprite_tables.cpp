@@ -0,0 +1,1127 @@
+/**
+ * Ada Particles - Baked Particle Sprites (generated by
+ * bench/bake_sprites; do not edit)
+ */
+
+#include "sprites.h"
+
+// Size 0: 9x9, 16 phases
+static const uint8_t ALPHA_0[1296] PROGMEM = {
+      0,   0,  10,  29,  29,  10,   0,   0,   0,   0,  29,  93, 146, 146,  93,  29,
+      0,   0,  10,  93, 177, 208, 208, 177,  93,  10,   0,  29, 146, 208, 245, 245,
+    208, 146,  29,   0,  29, 146, 208, 245, 245, 208, 146,  29,   0,  10,  93, 177,
+    208, 208, 177,  93,  10,   0,   0,  29,  93, 146, 146,  93,  29,   0,   0,   0,
+      0,  10,  29,  29,  10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   4,  25,  31,  15,   0,   0,   0,   0,  15,  76, 137, 152, 109,
+     43,   0,   0,   0,  67, 166, 203, 211, 187, 122,  25,   0,  11, 109, 195, 238,
+    248, 220, 166,  50,   0,  11, 109, 195, 238, 248, 220, 166,  50,   0,   0,  67,
+    166, 203, 211, 187, 122,  25,   0,   0,  15,  76, 137, 152, 109,  43,   0,   0,
+      0,   0,   4,  25,  31,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,  21,  31,  21,   0,   0,   0,   0,   4,  59, 124, 154,
+    124,  59,   4,   0,   0,  44, 154, 196, 212, 196, 154,  44,   0,   0,  77, 181,
+    230, 249, 230, 181,  77,   0,   0,  77, 181, 230, 249, 230, 181,  77,   0,   0,
+     44, 154, 196, 212, 196, 154,  44,   0,   0,   4,  59, 124, 154, 124,  59,   4,
+      0,   0,   0,   0,  21,  31,  21,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,  15,  31,  25,   4,   0,   0,   0,   0,  43, 109,
+    152, 137,  76,  15,   0,   0,  25, 122, 187, 211, 203, 166,  67,   0,   0,  50,
+    166, 220, 248, 238, 195, 109,  11,   0,  50, 166, 220, 248, 238, 195, 109,  11,
+      0,  25, 122, 187, 211, 203, 166,  67,   0,   0,   0,  43, 109, 152, 137,  76,
+     15,   0,   0,   0,   0,  15,  31,  25,   4,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,  11,  11,   0,   0,   0,   0,   0,  15,  67,
+    109, 109,  67,  15,   0,   0,   4,  76, 166, 195, 195, 166,  76,   4,   0,  25,
+    137, 203, 238, 238, 203, 137,  25,   0,  31, 152, 211, 248, 248, 211, 152,  31,
+      0,  15, 109, 187, 220, 220, 187, 109,  15,   0,   0,  43, 122, 166, 166, 122,
+     43,   0,   0,   0,   0,  25,  50,  50,  25,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   9,  13,   2,   0,   0,   0,   0,   5,
+     53, 102, 114,  80,  27,   0,   0,   0,  53, 156, 190, 198, 176, 102,  17,   0,
+      9, 102, 190, 233, 242, 215, 162,  46,   0,  13, 114, 198, 242, 252, 223, 169,
+     53,   0,   2,  80, 176, 215, 223, 198, 142,  33,   0,   0,  27, 102, 162, 169,
+    142,  61,   2,   0,   0,   0,  17,  46,  53,  33,   2,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  13,   6,   0,   0,   0,   0,
+      0,  40,  92, 116,  92,  40,   0,   0,   0,  34, 129, 184, 199, 184, 129,  34,
+      0,   0,  71, 177, 225, 243, 225, 177,  71,   0,   0,  81, 184, 234, 253, 234,
+    184,  81,   0,   0,  54, 163, 207, 225, 207, 163,  54,   0,   0,  13,  81, 157,
+    170, 157,  81,  13,   0,   0,   0,   9,  40,  54,  40,   9,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  13,   9,   0,   0,   0,
+      0,   0,  27,  80, 114, 102,  53,   5,   0,   0,  17, 102, 176, 198, 190, 156,
+     53,   0,   0,  46, 162, 215, 242, 233, 190, 102,   9,   0,  53, 169, 223, 252,
+    242, 198, 114,  13,   0,  33, 142, 198, 223, 215, 176,  80,   2,   0,   2,  61,
+    142, 169, 162, 102,  27,   0,   0,   0,   2,  33,  53,  46,  17,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   4,  44,  77,  77,  44,   4,   0,   0,   0,  59, 154, 181, 181, 154,
+     59,   0,   0,  21, 124, 196, 230, 230, 196, 124,  21,   0,  31, 154, 212, 249,
+    249, 212, 154,  31,   0,  21, 124, 196, 230, 230, 196, 124,  21,   0,   0,  59,
+    154, 181, 181, 154,  59,   0,   0,   0,   4,  44,  77,  77,  44,   4,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  34,  71,  81,  54,  13,   0,   0,   0,  40, 129, 177, 184,
+    163,  81,   9,   0,   6,  92, 184, 225, 234, 207, 157,  40,   0,  13, 116, 199,
+    243, 253, 225, 170,  54,   0,   6,  92, 184, 225, 234, 207, 157,  40,   0,   0,
+     40, 129, 177, 184, 163,  81,   9,   0,   0,   0,  34,  71,  81,  54,  13,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,  23,  63,  82,  63,  23,   0,   0,   0,  23, 105, 170,
+    185, 170, 105,  23,   0,   0,  63, 170, 217, 235, 217, 170,  63,   0,   0,  82,
+    185, 235, 255, 235, 185,  82,   0,   0,  63, 170, 217, 235, 217, 170,  63,   0,
+      0,  23, 105, 170, 185, 170, 105,  23,   0,   0,   0,  23,  63,  82,  63,  23,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,  13,  54,  81,  71,  34,   0,   0,   0,   9,  81,
+    163, 184, 177, 129,  40,   0,   0,  40, 157, 207, 234, 225, 184,  92,   6,   0,
+     54, 170, 225, 253, 243, 199, 116,  13,   0,  40, 157, 207, 234, 225, 184,  92,
+      6,   0,   9,  81, 163, 184, 177, 129,  40,   0,   0,   0,  13,  54,  81,  71,
+     34,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,  25,  50,  50,  25,   0,   0,   0,   0,  43,
+    122, 166, 166, 122,  43,   0,   0,  15, 109, 187, 220, 220, 187, 109,  15,   0,
+     31, 152, 211, 248, 248, 211, 152,  31,   0,  25, 137, 203, 238, 238, 203, 137,
+     25,   0,   4,  76, 166, 195, 195, 166,  76,   4,   0,   0,  15,  67, 109, 109,
+     67,  15,   0,   0,   0,   0,   0,  11,  11,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,  17,  46,  53,  33,   2,   0,   0,   0,
+     27, 102, 162, 169, 142,  61,   2,   0,   2,  80, 176, 215, 223, 198, 142,  33,
+      0,  13, 114, 198, 242, 252, 223, 169,  53,   0,   9, 102, 190, 233, 242, 215,
+    162,  46,   0,   0,  53, 156, 190, 198, 176, 102,  17,   0,   0,   5,  53, 102,
+    114,  80,  27,   0,   0,   0,   0,   0,   9,  13,   2,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   9,  40,  54,  40,   9,   0,   0,
+      0,  13,  81, 157, 170, 157,  81,  13,   0,   0,  54, 163, 207, 225, 207, 163,
+     54,   0,   0,  81, 184, 234, 253, 234, 184,  81,   0,   0,  71, 177, 225, 243,
+    225, 177,  71,   0,   0,  34, 129, 184, 199, 184, 129,  34,   0,   0,   0,  40,
+     92, 116,  92,  40,   0,   0,   0,   0,   0,   6,  13,   6,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  33,  53,  46,  17,   0,
+      0,   0,   2,  61, 142, 169, 162, 102,  27,   0,   0,  33, 142, 198, 223, 215,
+    176,  80,   2,   0,  53, 169, 223, 252, 242, 198, 114,  13,   0,  46, 162, 215,
+    242, 233, 190, 102,   9,   0,  17, 102, 176, 198, 190, 156,  53,   0,   0,   0,
+     27,  80, 114, 102,  53,   5,   0,   0,   0,   0,   2,  13,   9,   0,   0,   0,
+};
+
+static const SpriteSpan SPANS_0[144] PROGMEM = {
+    {  2,  4 }, {  1,  6 }, {  0,  8 }, {  0,  8 }, {  0,  8 }, {  0,  8 }, {  1,  6 }, {  2,  4 },
+    {  0,  0 }, {  2,  4 }, {  1,  6 }, {  1,  7 }, {  0,  8 }, {  0,  8 }, {  1,  7 }, {  1,  6 },
+    {  2,  4 }, {  0,  0 }, {  3,  3 }, {  1,  7 }, {  1,  7 }, {  1,  7 }, {  1,  7 }, {  1,  7 },
+    {  1,  7 }, {  3,  3 }, {  0,  0 }, {  3,  4 }, {  2,  6 }, {  1,  7 }, {  1,  8 }, {  1,  8 },
+    {  1,  7 }, {  2,  6 }, {  3,  4 }, {  0,  0 }, {  3,  2 }, {  1,  6 }, {  0,  8 }, {  0,  8 },
+    {  0,  8 }, {  0,  8 }, {  1,  6 }, {  2,  4 }, {  0,  0 }, {  3,  3 }, {  1,  6 }, {  1,  7 },
+    {  0,  8 }, {  0,  8 }, {  0,  8 }, {  1,  7 }, {  2,  5 }, {  0,  0 }, {  3,  3 }, {  2,  5 },
+    {  1,  7 }, {  1,  7 }, {  1,  7 }, {  1,  7 }, {  1,  7 }, {  2,  5 }, {  0,  0 }, {  3,  3 },
+    {  2,  6 }, {  1,  7 }, {  1,  8 }, {  1,  8 }, {  1,  8 }, {  1,  7 }, {  2,  5 }, {  0,  0 },
+    {  0,  0 }, {  1,  6 }, {  1,  6 }, {  0,  8 }, {  0,  8 }, {  0,  8 }, {  1,  6 }, {  1,  6 },
+    {  0,  0 }, {  0,  0 }, {  2,  5 }, {  1,  7 }, {  0,  8 }, {  0,  8 }, {  0,  8 }, {  1,  7 },
+    {  2,  5 }, {  0,  0 }, {  0,  0 }, {  2,  5 }, {  1,  7 }, {  1,  7 }, {  1,  7 }, {  1,  7 },
+    {  1,  7 }, {  2,  5 }, {  0,  0 }, {  0,  0 }, {  2,  5 }, {  1,  7 }, {  1,  8 }, {  1,  8 },
+    {  1,  8 }, {  1,  7 }, {  2,  5 }, {  0,  0 }, {  0,  0 }, {  2,  4 }, {  1,  6 }, {  0,  8 },
+    {  0,  8 }, {  0,  8 }, {  0,  8 }, {  1,  6 }, {  3,  2 }, {  0,  0 }, {  2,  5 }, {  1,  7 },
+    {  0,  8 }, {  0,  8 }, {  0,  8 }, {  1,  7 }, {  1,  6 }, {  3,  3 }, {  0,  0 }, {  2,  5 },
+    {  1,  7 }, {  1,  7 }, {  1,  7 }, {  1,  7 }, {  1,  7 }, {  2,  5 }, {  3,  3 }, {  0,  0 },
+    {  2,  5 }, {  1,  7 }, {  1,  8 }, {  1,  8 }, {  1,  8 }, {  1,  7 }, {  2,  6 }, {  3,  3 },
+};
+
+// Size 1: 17x17, 16 phases
+static const uint8_t ALPHA_1[4624] PROGMEM = {
+      0,   0,   0,   0,   0,   2,   9,  14,  14,   9,   2,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   2,  19,  38,  56,  66,  66,  56,  38,  19,   2,   0,   0,
+      0,   0,   0,   0,   5,  31,  66,  81,  92,  98,  98,  92,  81,  66,  31,   5,
+      0,   0,   0,   0,   2,  31,  71,  92, 111, 126, 134, 134, 126, 111,  92,  71,
+     31,   2,   0,   0,   0,  19,  66,  92, 118, 143, 162, 172, 172, 162, 143, 118,
+     92,  66,  19,   0,   0,   2,  38,  81, 111, 143, 172, 195, 208, 208, 195, 172,
+    143, 111,  81,  38,   2,   0,   9,  56,  92, 126, 162, 195, 221, 235, 235, 221,
+    195, 162, 126,  92,  56,   9,   0,  14,  66,  98, 134, 172, 208, 235, 251, 251,
+    235, 208, 172, 134,  98,  66,  14,   0,  14,  66,  98, 134, 172, 208, 235, 251,
+    251, 235, 208, 172, 134,  98,  66,  14,   0,   9,  56,  92, 126, 162, 195, 221,
+    235, 235, 221, 195, 162, 126,  92,  56,   9,   0,   2,  38,  81, 111, 143, 172,
+    195, 208, 208, 195, 172, 143, 111,  81,  38,   2,   0,   0,  19,  66,  92, 118,
+    143, 162, 172, 172, 162, 143, 118,  92,  66,  19,   0,   0,   0,   2,  31,  71,
+     92, 111, 126, 134, 134, 126, 111,  92,  71,  31,   2,   0,   0,   0,   0,   5,
+     31,  66,  81,  92,  98,  98,  92,  81,  66,  31,   5,   0,   0,   0,   0,   0,
+      0,   2,  19,  38,  56,  66,  66,  56,  38,  19,   2,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   2,   9,  14,  14,   9,   2,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   7,  13,  14,  11,   4,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,  14,  33,  52,  64,  67,  59,  43,  23,   6,   0,
+      0,   0,   0,   0,   0,   1,  23,  57,  78,  90,  97,  98,  94,  84,  71,  39,
+     11,   0,   0,   0,   0,   0,  22,  64,  87, 106, 123, 133, 135, 128, 115,  97,
+     77,  41,   7,   0,   0,   0,  11,  52,  85, 112, 137, 158, 170, 173, 165, 148,
+    125,  98,  73,  28,   0,   0,   0,  27,  74, 103, 135, 165, 190, 206, 209, 199,
+    179, 150, 119,  88,  52,   8,   0,   2,  41,  84, 117, 153, 187, 215, 233, 237,
+    226, 202, 170, 135, 100,  70,  18,   0,   6,  50,  90, 125, 163, 199, 229, 248,
+    252, 240, 215, 181, 143, 106,  74,  23,   0,   6,  50,  90, 125, 163, 199, 229,
+    248, 252, 240, 215, 181, 143, 106,  74,  23,   0,   2,  41,  84, 117, 153, 187,
+    215, 233, 237, 226, 202, 170, 135, 100,  70,  18,   0,   0,  27,  74, 103, 135,
+    165, 190, 206, 209, 199, 179, 150, 119,  88,  52,   8,   0,   0,  11,  52,  85,
+    112, 137, 158, 170, 173, 165, 148, 125,  98,  73,  28,   0,   0,   0,   0,  22,
+     64,  87, 106, 123, 133, 135, 128, 115,  97,  77,  41,   7,   0,   0,   0,   0,
+      1,  23,  57,  78,  90,  97,  98,  94,  84,  71,  39,  11,   0,   0,   0,   0,
+      0,   0,   0,  14,  33,  52,  64,  67,  59,  43,  23,   6,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   7,  13,  14,  11,   4,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   6,  12,  14,  12,   6,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,  10,  28,  48,  62,  68,  62,  48,  28,  10,
+      0,   0,   0,   0,   0,   0,   0,  17,  48,  74,  87,  96,  99,  96,  87,  74,
+     48,  17,   0,   0,   0,   0,   0,  14,  52,  82, 102, 119, 131, 135, 131, 119,
+    102,  82,  52,  14,   0,   0,   0,   4,  39,  79, 105, 131, 153, 168, 173, 168,
+    153, 131, 105,  79,  39,   4,   0,   0,  17,  68,  96, 127, 158, 185, 203, 209,
+    203, 185, 158, 127,  96,  68,  17,   0,   0,  28,  77, 108, 144, 179, 209, 230,
+    237, 230, 209, 179, 144, 108,  77,  28,   0,   0,  35,  82, 115, 153, 190, 223,
+    245, 253, 245, 223, 190, 153, 115,  82,  35,   0,   0,  35,  82, 115, 153, 190,
+    223, 245, 253, 245, 223, 190, 153, 115,  82,  35,   0,   0,  28,  77, 108, 144,
+    179, 209, 230, 237, 230, 209, 179, 144, 108,  77,  28,   0,   0,  17,  68,  96,
+    127, 158, 185, 203, 209, 203, 185, 158, 127,  96,  68,  17,   0,   0,   4,  39,
+     79, 105, 131, 153, 168, 173, 168, 153, 131, 105,  79,  39,   4,   0,   0,   0,
+     14,  52,  82, 102, 119, 131, 135, 131, 119, 102,  82,  52,  14,   0,   0,   0,
+      0,   0,  17,  48,  74,  87,  96,  99,  96,  87,  74,  48,  17,   0,   0,   0,
+      0,   0,   0,   0,  10,  28,  48,  62,  68,  62,  48,  28,  10,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   6,  12,  14,  12,   6,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  11,  14,  13,   7,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   6,  23,  43,  59,  67,  64,  52,  33,
+     14,   0,   0,   0,   0,   0,   0,   0,  11,  39,  71,  84,  94,  98,  97,  90,
+     78,  57,  23,   1,   0,   0,   0,   0,   7,  41,  77,  97, 115, 128, 135, 133,
+    123, 106,  87,  64,  22,   0,   0,   0,   0,  28,  73,  98, 125, 148, 165, 173,
+    170, 158, 137, 112,  85,  52,  11,   0,   0,   8,  52,  88, 119, 150, 179, 199,
+    209, 206, 190, 165, 135, 103,  74,  27,   0,   0,  18,  70, 100, 135, 170, 202,
+    226, 237, 233, 215, 187, 153, 117,  84,  41,   2,   0,  23,  74, 106, 143, 181,
+    215, 240, 252, 248, 229, 199, 163, 125,  90,  50,   6,   0,  23,  74, 106, 143,
+    181, 215, 240, 252, 248, 229, 199, 163, 125,  90,  50,   6,   0,  18,  70, 100,
+    135, 170, 202, 226, 237, 233, 215, 187, 153, 117,  84,  41,   2,   0,   8,  52,
+     88, 119, 150, 179, 199, 209, 206, 190, 165, 135, 103,  74,  27,   0,   0,   0,
+     28,  73,  98, 125, 148, 165, 173, 170, 158, 137, 112,  85,  52,  11,   0,   0,
+      0,   7,  41,  77,  97, 115, 128, 135, 133, 123, 106,  87,  64,  22,   0,   0,
+      0,   0,   0,  11,  39,  71,  84,  94,  98,  97,  90,  78,  57,  23,   1,   0,
+      0,   0,   0,   0,   0,   6,  23,  43,  59,  67,  64,  52,  33,  14,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   4,  11,  14,  13,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   6,   6,   2,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,  11,  27,  41,  50,  50,  41,  27,
+     11,   0,   0,   0,   0,   0,   0,   0,   1,  22,  52,  74,  84,  90,  90,  84,
+     74,  52,  22,   1,   0,   0,   0,   0,   0,  23,  64,  85, 103, 117, 125, 125,
+    117, 103,  85,  64,  23,   0,   0,   0,   0,  14,  57,  87, 112, 135, 153, 163,
+    163, 153, 135, 112,  87,  57,  14,   0,   0,   0,  33,  78, 106, 137, 165, 187,
+    199, 199, 187, 165, 137, 106,  78,  33,   0,   0,   7,  52,  90, 123, 158, 190,
+    215, 229, 229, 215, 190, 158, 123,  90,  52,   7,   0,  13,  64,  97, 133, 170,
+    206, 233, 248, 248, 233, 206, 170, 133,  97,  64,  13,   0,  14,  67,  98, 135,
+    173, 209, 237, 252, 252, 237, 209, 173, 135,  98,  67,  14,   0,  11,  59,  94,
+    128, 165, 199, 226, 240, 240, 226, 199, 165, 128,  94,  59,  11,   0,   4,  43,
+     84, 115, 148, 179, 202, 215, 215, 202, 179, 148, 115,  84,  43,   4,   0,   0,
+     23,  71,  97, 125, 150, 170, 181, 181, 170, 150, 125,  97,  71,  23,   0,   0,
+      0,   6,  39,  77,  98, 119, 135, 143, 143, 135, 119,  98,  77,  39,   6,   0,
+      0,   0,   0,  11,  41,  73,  88, 100, 106, 106, 100,  88,  73,  41,  11,   0,
+      0,   0,   0,   0,   0,   7,  28,  52,  70,  74,  74,  70,  52,  28,   7,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   8,  18,  23,  23,  18,   8,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   5,   6,   3,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,  22,  38,  48,  50,  44,
+     30,  14,   0,   0,   0,   0,   0,   0,   0,   0,  16,  44,  71,  82,  89,  90,
+     86,  77,  60,  29,   5,   0,   0,   0,   0,   0,  16,  53,  81,  99, 114, 123,
+    125, 119, 107,  90,  71,  32,   3,   0,   0,   0,   7,  44,  81, 105, 129, 149,
+    161, 163, 156, 140, 118,  93,  69,  22,   0,   0,   0,  22,  71,  99, 129, 158,
+    182, 197, 200, 191, 171, 144, 114,  85,  46,   6,   0,   1,  38,  82, 114, 149,
+    182, 210, 227, 231, 220, 197, 166, 131,  97,  68,  16,   0,   5,  48,  89, 123,
+    161, 197, 227, 246, 250, 238, 213, 180, 142, 105,  73,  22,   0,   6,  50,  90,
+    125, 163, 200, 231, 250, 254, 242, 217, 182, 144, 107,  75,  24,   0,   3,  44,
+     86, 119, 156, 191, 220, 238, 242, 231, 207, 174, 138, 102,  71,  20,   0,   0,
+     30,  77, 107, 140, 171, 197, 213, 217, 207, 185, 156, 123,  91,  58,  11,   0,
+      0,  14,  60,  90, 118, 144, 166, 180, 182, 174, 156, 131, 104,  77,  34,   1,
+      0,   0,   0,  29,  71,  93, 114, 131, 142, 144, 138, 123, 104,  82,  50,  12,
+      0,   0,   0,   0,   5,  32,  69,  85,  97, 105, 107, 102,  91,  77,  50,  17,
+      0,   0,   0,   0,   0,   0,   3,  22,  46,  68,  73,  75,  71,  58,  34,  12,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  16,  22,  24,  20,  11,   1,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   6,   4,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  18,  34,  46,  51,
+     46,  34,  18,   3,   0,   0,   0,   0,   0,   0,   0,  10,  36,  68,  80,  87,
+     90,  87,  80,  68,  36,  10,   0,   0,   0,   0,   0,   9,  42,  76,  95, 111,
+    122, 125, 122, 111,  95,  76,  42,   9,   0,   0,   0,   1,  32,  75,  99, 124,
+    145, 159, 164, 159, 145, 124,  99,  75,  32,   1,   0,   0,  13,  60,  92, 122,
+    151, 177, 195, 201, 195, 177, 151, 122,  92,  60,  13,   0,   0,  26,  75, 106,
+    140, 174, 204, 224, 231, 224, 204, 174, 140, 106,  75,  26,   0,   0,  34,  81,
+    114, 151, 189, 221, 242, 250, 242, 221, 189, 151, 114,  81,  34,   0,   0,  36,
+     82, 116, 154, 192, 224, 246, 254, 246, 224, 192, 154, 116,  82,  36,   0,   0,
+     31,  78, 111, 147, 183, 214, 235, 242, 235, 214, 183, 147, 111,  78,  31,   0,
+      0,  20,  70,  99, 132, 164, 192, 210, 217, 210, 192, 164, 132,  99,  70,  20,
+      0,   0,   7,  46,  83, 111, 138, 161, 177, 183, 177, 161, 138, 111,  83,  46,
+      7,   0,   0,   0,  20,  63,  87, 109, 127, 140, 145, 140, 127, 109,  87,  63,
+     20,   0,   0,   0,   0,   0,  24,  60,  81,  95, 104, 107, 104,  95,  81,  60,
+     24,   0,   0,   0,   0,   0,   0,   0,  17,  40,  63,  72,  75,  72,  63,  40,
+     17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  13,  21,  24,  21,  13,
+      3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   6,
+      5,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  14,  30,  44,
+     50,  48,  38,  22,   7,   0,   0,   0,   0,   0,   0,   0,   5,  29,  60,  77,
+     86,  90,  89,  82,  71,  44,  16,   0,   0,   0,   0,   0,   3,  32,  71,  90,
+    107, 119, 125, 123, 114,  99,  81,  53,  16,   0,   0,   0,   0,  22,  69,  93,
+    118, 140, 156, 163, 161, 149, 129, 105,  81,  44,   7,   0,   0,   6,  46,  85,
+    114, 144, 171, 191, 200, 197, 182, 158, 129,  99,  71,  22,   0,   0,  16,  68,
+     97, 131, 166, 197, 220, 231, 227, 210, 182, 149, 114,  82,  38,   1,   0,  22,
+     73, 105, 142, 180, 213, 238, 250, 246, 227, 197, 161, 123,  89,  48,   5,   0,
+     24,  75, 107, 144, 182, 217, 242, 254, 250, 231, 200, 163, 125,  90,  50,   6,
+      0,  20,  71, 102, 138, 174, 207, 231, 242, 238, 220, 191, 156, 119,  86,  44,
+      3,   0,  11,  58,  91, 123, 156, 185, 207, 217, 213, 197, 171, 140, 107,  77,
+     30,   0,   0,   1,  34,  77, 104, 131, 156, 174, 182, 180, 166, 144, 118,  90,
+     60,  14,   0,   0,   0,  12,  50,  82, 104, 123, 138, 144, 142, 131, 114,  93,
+     71,  29,   0,   0,   0,   0,   0,  17,  50,  77,  91, 102, 107, 105,  97,  85,
+     69,  32,   5,   0,   0,   0,   0,   0,   0,  12,  34,  58,  71,  75,  73,  68,
+     46,  22,   3,   0,   0,   0,   0,   0,   0,   0,   0,   1,  11,  20,  24,  22,
+     16,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  17,  28,
+     35,  35,  28,  17,   4,   0,   0,   0,   0,   0,   0,   0,   0,  14,  39,  68,
+     77,  82,  82,  77,  68,  39,  14,   0,   0,   0,   0,   0,   0,  17,  52,  79,
+     96, 108, 115, 115, 108,  96,  79,  52,  17,   0,   0,   0,   0,  10,  48,  82,
+    105, 127, 144, 153, 153, 144, 127, 105,  82,  48,  10,   0,   0,   0,  28,  74,
+    102, 131, 158, 179, 190, 190, 179, 158, 131, 102,  74,  28,   0,   0,   6,  48,
+     87, 119, 153, 185, 209, 223, 223, 209, 185, 153, 119,  87,  48,   6,   0,  12,
+     62,  96, 131, 168, 203, 230, 245, 245, 230, 203, 168, 131,  96,  62,  12,   0,
+     14,  68,  99, 135, 173, 209, 237, 253, 253, 237, 209, 173, 135,  99,  68,  14,
+      0,  12,  62,  96, 131, 168, 203, 230, 245, 245, 230, 203, 168, 131,  96,  62,
+     12,   0,   6,  48,  87, 119, 153, 185, 209, 223, 223, 209, 185, 153, 119,  87,
+     48,   6,   0,   0,  28,  74, 102, 131, 158, 179, 190, 190, 179, 158, 131, 102,
+     74,  28,   0,   0,   0,  10,  48,  82, 105, 127, 144, 153, 153, 144, 127, 105,
+     82,  48,  10,   0,   0,   0,   0,  17,  52,  79,  96, 108, 115, 115, 108,  96,
+     79,  52,  17,   0,   0,   0,   0,   0,   0,  14,  39,  68,  77,  82,  82,  77,
+     68,  39,  14,   0,   0,   0,   0,   0,   0,   0,   0,   4,  17,  28,  35,  35,
+     28,  17,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  13,
+     26,  34,  36,  31,  20,   7,   0,   0,   0,   0,   0,   0,   0,   0,   9,  32,
+     60,  75,  81,  82,  78,  70,  46,  20,   0,   0,   0,   0,   0,   0,  10,  42,
+     75,  92, 106, 114, 116, 111,  99,  83,  63,  24,   0,   0,   0,   0,   3,  36,
+     76,  99, 122, 140, 151, 154, 147, 132, 111,  87,  60,  17,   0,   0,   0,  18,
+     68,  95, 124, 151, 174, 189, 192, 183, 164, 138, 109,  81,  40,   3,   0,   0,
+     34,  80, 111, 145, 177, 204, 221, 224, 214, 192, 161, 127,  95,  63,  13,   0,
+      4,  46,  87, 122, 159, 195, 224, 242, 246, 235, 210, 177, 140, 104,  72,  21,
+      0,   6,  51,  90, 125, 164, 201, 231, 250, 254, 242, 217, 183, 145, 107,  75,
+     24,   0,   4,  46,  87, 122, 159, 195, 224, 242, 246, 235, 210, 177, 140, 104,
+     72,  21,   0,   0,  34,  80, 111, 145, 177, 204, 221, 224, 214, 192, 161, 127,
+     95,  63,  13,   0,   0,  18,  68,  95, 124, 151, 174, 189, 192, 183, 164, 138,
+    109,  81,  40,   3,   0,   0,   3,  36,  76,  99, 122, 140, 151, 154, 147, 132,
+    111,  87,  60,  17,   0,   0,   0,   0,  10,  42,  75,  92, 106, 114, 116, 111,
+     99,  83,  63,  24,   0,   0,   0,   0,   0,   0,   9,  32,  60,  75,  81,  82,
+     78,  70,  46,  20,   0,   0,   0,   0,   0,   0,   0,   0,   1,  13,  26,  34,
+     36,  31,  20,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     10,  23,  33,  36,  33,  23,  10,   0,   0,   0,   0,   0,   0,   0,   0,   4,
+     26,  53,  73,  80,  82,  80,  73,  53,  26,   4,   0,   0,   0,   0,   0,   4,
+     33,  70,  88, 103, 113, 116, 113, 103,  88,  70,  33,   4,   0,   0,   0,   0,
+     26,  70,  93, 116, 136, 149, 154, 149, 136, 116,  93,  70,  26,   0,   0,   0,
+     10,  53,  88, 116, 145, 169, 186, 192, 186, 169, 145, 116,  88,  53,  10,   0,
+      0,  23,  73, 103, 136, 169, 198, 218, 225, 218, 198, 169, 136, 103,  73,  23,
+      0,   0,  33,  80, 113, 149, 186, 218, 239, 247, 239, 218, 186, 149, 113,  80,
+     33,   0,   0,  36,  82, 116, 154, 192, 225, 247, 255, 247, 225, 192, 154, 116,
+     82,  36,   0,   0,  33,  80, 113, 149, 186, 218, 239, 247, 239, 218, 186, 149,
+    113,  80,  33,   0,   0,  23,  73, 103, 136, 169, 198, 218, 225, 218, 198, 169,
+    136, 103,  73,  23,   0,   0,  10,  53,  88, 116, 145, 169, 186, 192, 186, 169,
+    145, 116,  88,  53,  10,   0,   0,   0,  26,  70,  93, 116, 136, 149, 154, 149,
+    136, 116,  93,  70,  26,   0,   0,   0,   0,   4,  33,  70,  88, 103, 113, 116,
+    113, 103,  88,  70,  33,   4,   0,   0,   0,   0,   0,   4,  26,  53,  73,  80,
+     82,  80,  73,  53,  26,   4,   0,   0,   0,   0,   0,   0,   0,   0,  10,  23,
+     33,  36,  33,  23,  10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   7,  20,  31,  36,  34,  26,  13,   1,   0,   0,   0,   0,   0,   0,   0,
+      0,  20,  46,  70,  78,  82,  81,  75,  60,  32,   9,   0,   0,   0,   0,   0,
+      0,  24,  63,  83,  99, 111, 116, 114, 106,  92,  75,  42,  10,   0,   0,   0,
+      0,  17,  60,  87, 111, 132, 147, 154, 151, 140, 122,  99,  76,  36,   3,   0,
+      0,   3,  40,  81, 109, 138, 164, 183, 192, 189, 174, 151, 124,  95,  68,  18,
+      0,   0,  13,  63,  95, 127, 161, 192, 214, 224, 221, 204, 177, 145, 111,  80,
+     34,   0,   0,  21,  72, 104, 140, 177, 210, 235, 246, 242, 224, 195, 159, 122,
+     87,  46,   4,   0,  24,  75, 107, 145, 183, 217, 242, 254, 250, 231, 201, 164,
+    125,  90,  51,   6,   0,  21,  72, 104, 140, 177, 210, 235, 246, 242, 224, 195,
+    159, 122,  87,  46,   4,   0,  13,  63,  95, 127, 161, 192, 214, 224, 221, 204,
+    177, 145, 111,  80,  34,   0,   0,   3,  40,  81, 109, 138, 164, 183, 192, 189,
+    174, 151, 124,  95,  68,  18,   0,   0,   0,  17,  60,  87, 111, 132, 147, 154,
+    151, 140, 122,  99,  76,  36,   3,   0,   0,   0,   0,  24,  63,  83,  99, 111,
+    116, 114, 106,  92,  75,  42,  10,   0,   0,   0,   0,   0,   0,  20,  46,  70,
+     78,  82,  81,  75,  60,  32,   9,   0,   0,   0,   0,   0,   0,   0,   0,   7,
+     20,  31,  36,  34,  26,  13,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   8,  18,  23,  23,  18,   8,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   7,  28,  52,  70,  74,  74,  70,  52,  28,   7,   0,   0,   0,   0,   0,
+      0,  11,  41,  73,  88, 100, 106, 106, 100,  88,  73,  41,  11,   0,   0,   0,
+      0,   6,  39,  77,  98, 119, 135, 143, 143, 135, 119,  98,  77,  39,   6,   0,
+      0,   0,  23,  71,  97, 125, 150, 170, 181, 181, 170, 150, 125,  97,  71,  23,
+      0,   0,   4,  43,  84, 115, 148, 179, 202, 215, 215, 202, 179, 148, 115,  84,
+     43,   4,   0,  11,  59,  94, 128, 165, 199, 226, 240, 240, 226, 199, 165, 128,
+     94,  59,  11,   0,  14,  67,  98, 135, 173, 209, 237, 252, 252, 237, 209, 173,
+    135,  98,  67,  14,   0,  13,  64,  97, 133, 170, 206, 233, 248, 248, 233, 206,
+    170, 133,  97,  64,  13,   0,   7,  52,  90, 123, 158, 190, 215, 229, 229, 215,
+    190, 158, 123,  90,  52,   7,   0,   0,  33,  78, 106, 137, 165, 187, 199, 199,
+    187, 165, 137, 106,  78,  33,   0,   0,   0,  14,  57,  87, 112, 135, 153, 163,
+    163, 153, 135, 112,  87,  57,  14,   0,   0,   0,   0,  23,  64,  85, 103, 117,
+    125, 125, 117, 103,  85,  64,  23,   0,   0,   0,   0,   0,   1,  22,  52,  74,
+     84,  90,  90,  84,  74,  52,  22,   1,   0,   0,   0,   0,   0,   0,   0,  11,
+     27,  41,  50,  50,  41,  27,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   2,   6,   6,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   6,  16,  22,  24,  20,  11,   1,   0,   0,   0,   0,   0,   0,
+      0,   0,   3,  22,  46,  68,  73,  75,  71,  58,  34,  12,   0,   0,   0,   0,
+      0,   0,   5,  32,  69,  85,  97, 105, 107, 102,  91,  77,  50,  17,   0,   0,
+      0,   0,   0,  29,  71,  93, 114, 131, 142, 144, 138, 123, 104,  82,  50,  12,
+      0,   0,   0,  14,  60,  90, 118, 144, 166, 180, 182, 174, 156, 131, 104,  77,
+     34,   1,   0,   0,  30,  77, 107, 140, 171, 197, 213, 217, 207, 185, 156, 123,
+     91,  58,  11,   0,   3,  44,  86, 119, 156, 191, 220, 238, 242, 231, 207, 174,
+    138, 102,  71,  20,   0,   6,  50,  90, 125, 163, 200, 231, 250, 254, 242, 217,
+    182, 144, 107,  75,  24,   0,   5,  48,  89, 123, 161, 197, 227, 246, 250, 238,
+    213, 180, 142, 105,  73,  22,   0,   1,  38,  82, 114, 149, 182, 210, 227, 231,
+    220, 197, 166, 131,  97,  68,  16,   0,   0,  22,  71,  99, 129, 158, 182, 197,
+    200, 191, 171, 144, 114,  85,  46,   6,   0,   0,   7,  44,  81, 105, 129, 149,
+    161, 163, 156, 140, 118,  93,  69,  22,   0,   0,   0,   0,  16,  53,  81,  99,
+    114, 123, 125, 119, 107,  90,  71,  32,   3,   0,   0,   0,   0,   0,  16,  44,
+     71,  82,  89,  90,  86,  77,  60,  29,   5,   0,   0,   0,   0,   0,   0,   0,
+      7,  22,  38,  48,  50,  44,  30,  14,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   1,   5,   6,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,  13,  21,  24,  21,  13,   3,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  17,  40,  63,  72,  75,  72,  63,  40,  17,   0,   0,   0,
+      0,   0,   0,   0,  24,  60,  81,  95, 104, 107, 104,  95,  81,  60,  24,   0,
+      0,   0,   0,   0,  20,  63,  87, 109, 127, 140, 145, 140, 127, 109,  87,  63,
+     20,   0,   0,   0,   7,  46,  83, 111, 138, 161, 177, 183, 177, 161, 138, 111,
+     83,  46,   7,   0,   0,  20,  70,  99, 132, 164, 192, 210, 217, 210, 192, 164,
+    132,  99,  70,  20,   0,   0,  31,  78, 111, 147, 183, 214, 235, 242, 235, 214,
+    183, 147, 111,  78,  31,   0,   0,  36,  82, 116, 154, 192, 224, 246, 254, 246,
+    224, 192, 154, 116,  82,  36,   0,   0,  34,  81, 114, 151, 189, 221, 242, 250,
+    242, 221, 189, 151, 114,  81,  34,   0,   0,  26,  75, 106, 140, 174, 204, 224,
+    231, 224, 204, 174, 140, 106,  75,  26,   0,   0,  13,  60,  92, 122, 151, 177,
+    195, 201, 195, 177, 151, 122,  92,  60,  13,   0,   0,   1,  32,  75,  99, 124,
+    145, 159, 164, 159, 145, 124,  99,  75,  32,   1,   0,   0,   0,   9,  42,  76,
+     95, 111, 122, 125, 122, 111,  95,  76,  42,   9,   0,   0,   0,   0,   0,  10,
+     36,  68,  80,  87,  90,  87,  80,  68,  36,  10,   0,   0,   0,   0,   0,   0,
+      0,   3,  18,  34,  46,  51,  46,  34,  18,   3,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   4,   6,   4,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   1,  11,  20,  24,  22,  16,   6,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,  12,  34,  58,  71,  75,  73,  68,  46,  22,   3,   0,
+      0,   0,   0,   0,   0,  17,  50,  77,  91, 102, 107, 105,  97,  85,  69,  32,
+      5,   0,   0,   0,   0,  12,  50,  82, 104, 123, 138, 144, 142, 131, 114,  93,
+     71,  29,   0,   0,   0,   1,  34,  77, 104, 131, 156, 174, 182, 180, 166, 144,
+    118,  90,  60,  14,   0,   0,  11,  58,  91, 123, 156, 185, 207, 217, 213, 197,
+    171, 140, 107,  77,  30,   0,   0,  20,  71, 102, 138, 174, 207, 231, 242, 238,
+    220, 191, 156, 119,  86,  44,   3,   0,  24,  75, 107, 144, 182, 217, 242, 254,
+    250, 231, 200, 163, 125,  90,  50,   6,   0,  22,  73, 105, 142, 180, 213, 238,
+    250, 246, 227, 197, 161, 123,  89,  48,   5,   0,  16,  68,  97, 131, 166, 197,
+    220, 231, 227, 210, 182, 149, 114,  82,  38,   1,   0,   6,  46,  85, 114, 144,
+    171, 191, 200, 197, 182, 158, 129,  99,  71,  22,   0,   0,   0,  22,  69,  93,
+    118, 140, 156, 163, 161, 149, 129, 105,  81,  44,   7,   0,   0,   0,   3,  32,
+     71,  90, 107, 119, 125, 123, 114,  99,  81,  53,  16,   0,   0,   0,   0,   0,
+      5,  29,  60,  77,  86,  90,  89,  82,  71,  44,  16,   0,   0,   0,   0,   0,
+      0,   0,   0,  14,  30,  44,  50,  48,  38,  22,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   3,   6,   5,   1,   0,   0,   0,   0,   0,   0,
+};
+
+static const SpriteSpan SPANS_1[272] PROGMEM = {
+    {  5,  6 }, {  3, 10 }, {  2, 12 }, {  1, 14 }, {  1, 14 }, {  0, 16 }, {  0, 16 }, {  0, 16 },
+    {  0, 16 }, {  0, 16 }, {  0, 16 }, {  1, 14 }, {  1, 14 }, {  2, 12 }, {  3, 10 }, {  5,  6 },
+    {  0,  0 }, {  6,  5 }, {  4,  9 }, {  2, 12 }, {  2, 13 }, {  1, 14 }, {  1, 15 }, {  0, 16 },
+    {  0, 16 }, {  0, 16 }, {  0, 16 }, {  1, 15 }, {  1, 14 }, {  2, 13 }, {  2, 12 }, {  4,  9 },
+    {  6,  5 }, {  0,  0 }, {  6,  5 }, {  4,  9 }, {  3, 11 }, {  2, 13 }, {  1, 15 }, {  1, 15 },
+    {  1, 15 }, {  1, 15 }, {  1, 15 }, {  1, 15 }, {  1, 15 }, {  1, 15 }, {  2, 13 }, {  3, 11 },
+    {  4,  9 }, {  6,  5 }, {  0,  0 }, {  6,  5 }, {  4,  9 }, {  3, 12 }, {  2, 13 }, {  2, 14 },
+    {  1, 15 }, {  1, 16 }, {  1, 16 }, {  1, 16 }, {  1, 16 }, {  1, 15 }, {  2, 14 }, {  2, 13 },
+    {  3, 12 }, {  4,  9 }, {  6,  5 }, {  0,  0 }, {  6,  4 }, {  4,  8 }, {  2, 12 }, {  2, 12 },
+    {  1, 14 }, {  1, 14 }, {  0, 16 }, {  0, 16 }, {  0, 16 }, {  0, 16 }, {  0, 16 }, {  1, 14 },
+    {  1, 14 }, {  2, 12 }, {  3, 10 }, {  5,  6 }, {  0,  0 }, {  6,  4 }, {  4,  8 }, {  3, 11 },
+    {  2, 13 }, {  1, 14 }, {  1, 15 }, {  0, 16 }, {  0, 16 }, {  0, 16 }, {  0, 16 }, {  1, 15 },
+    {  1, 15 }, {  2, 13 }, {  2, 12 }, {  3, 10 }, {  5,  7 }, {  0,  0 }, {  7,  3 }, {  4,  9 },
+    {  3, 11 }, {  2, 13 }, {  1, 15 }, {  1, 15 }, {  1, 15 }, {  1, 15 }, {  1, 15 }, {  1, 15 },
+    {  1, 15 }, {  1, 15 }, {  2, 13 }, {  3, 11 }, {  4,  9 }, {  5,  7 }, {  0,  0 }, {  7,  4 },
+    {  5,  8 }, {  3, 11 }, {  2, 13 }, {  2, 14 }, {  1, 15 }, {  1, 16 }, {  1, 16 }, {  1, 16 },
+    {  1, 16 }, {  1, 15 }, {  1, 15 }, {  2, 13 }, {  3, 12 }, {  4, 10 }, {  5,  7 }, {  0,  0 },
+    {  0,  0 }, {  4,  8 }, {  3, 10 }, {  2, 12 }, {  1, 14 }, {  1, 14 }, {  0, 16 }, {  0, 16 },
+    {  0, 16 }, {  0, 16 }, {  0, 16 }, {  1, 14 }, {  1, 14 }, {  2, 12 }, {  3, 10 }, {  4,  8 },
+    {  0,  0 }, {  0,  0 }, {  4,  8 }, {  3, 10 }, {  2, 12 }, {  1, 14 }, {  1, 15 }, {  1, 15 },
+    {  0, 16 }, {  0, 16 }, {  0, 16 }, {  1, 15 }, {  1, 15 }, {  1, 14 }, {  2, 12 }, {  3, 10 },
+    {  4,  8 }, {  0,  0 }, {  0,  0 }, {  5,  7 }, {  3, 11 }, {  2, 13 }, {  2, 13 }, {  1, 15 },
+    {  1, 15 }, {  1, 15 }, {  1, 15 }, {  1, 15 }, {  1, 15 }, {  1, 15 }, {  2, 13 }, {  2, 13 },
+    {  3, 11 }, {  5,  7 }, {  0,  0 }, {  0,  0 }, {  5,  8 }, {  4, 10 }, {  3, 12 }, {  2, 14 },
+    {  1, 15 }, {  1, 15 }, {  1, 16 }, {  1, 16 }, {  1, 16 }, {  1, 15 }, {  1, 15 }, {  2, 14 },
+    {  3, 12 }, {  4, 10 }, {  5,  8 }, {  0,  0 }, {  0,  0 }, {  5,  6 }, {  3, 10 }, {  2, 12 },
+    {  1, 14 }, {  1, 14 }, {  0, 16 }, {  0, 16 }, {  0, 16 }, {  0, 16 }, {  0, 16 }, {  1, 14 },
+    {  1, 14 }, {  2, 12 }, {  2, 12 }, {  4,  8 }, {  6,  4 }, {  0,  0 }, {  5,  7 }, {  3, 10 },
+    {  2, 12 }, {  2, 13 }, {  1, 15 }, {  1, 15 }, {  0, 16 }, {  0, 16 }, {  0, 16 }, {  0, 16 },
+    {  1, 15 }, {  1, 14 }, {  2, 13 }, {  3, 11 }, {  4,  8 }, {  6,  4 }, {  0,  0 }, {  5,  7 },
+    {  4,  9 }, {  3, 11 }, {  2, 13 }, {  1, 15 }, {  1, 15 }, {  1, 15 }, {  1, 15 }, {  1, 15 },
+    {  1, 15 }, {  1, 15 }, {  1, 15 }, {  2, 13 }, {  3, 11 }, {  4,  9 }, {  7,  3 }, {  0,  0 },
+    {  5,  7 }, {  4, 10 }, {  3, 12 }, {  2, 13 }, {  1, 15 }, {  1, 15 }, {  1, 16 }, {  1, 16 },
+    {  1, 16 }, {  1, 16 }, {  1, 15 }, {  2, 14 }, {  2, 13 }, {  3, 11 }, {  5,  8 }, {  7,  4 },
+};
+
+// Size 2: 25x25, 16 phases
+static const uint8_t ALPHA_2[10000] PROGMEM = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  10,  13,  13,  10,   5,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,
+     15,  28,  40,  49,  54,  54,  49,  40,  28,  15,   3,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,  13,  32,  54,  61,  66,  70,  72,  72,  70,
+     66,  61,  54,  32,  13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  18,
+     45,  61,  70,  78,  85,  90,  93,  93,  90,  85,  78,  70,  61,  45,  18,   0,
+      0,   0,   0,   0,   0,   0,   0,  18,  49,  64,  76,  88,  98, 107, 113, 116,
+    116, 113, 107,  98,  88,  76,  64,  49,  18,   0,   0,   0,   0,   0,   0,  13,
+     45,  64,  78,  93, 107, 119, 130, 137, 141, 141, 137, 130, 119, 107,  93,  78,
+     64,  45,  13,   0,   0,   0,   0,   3,  32,  61,  76,  93, 110, 126, 141, 153,
+    162, 166, 166, 162, 153, 141, 126, 110,  93,  76,  61,  32,   3,   0,   0,   0,
+     15,  54,  70,  88, 107, 126, 145, 162, 176, 186, 191, 191, 186, 176, 162, 145,
+    126, 107,  88,  70,  54,  15,   0,   0,   0,  28,  61,  78,  98, 119, 141, 162,
+    181, 197, 208, 214, 214, 208, 197, 181, 162, 141, 119,  98,  78,  61,  28,   0,
+      0,   5,  40,  66,  85, 107, 130, 153, 176, 197, 214, 226, 232, 232, 226, 214,
+    197, 176, 153, 130, 107,  85,  66,  40,   5,   0,  10,  49,  70,  90, 113, 137,
+    162, 186, 208, 226, 239, 246, 246, 239, 226, 208, 186, 162, 137, 113,  90,  70,
+     49,  10,   0,  13,  54,  72,  93, 116, 141, 166, 191, 214, 232, 246, 253, 253,
+    246, 232, 214, 191, 166, 141, 116,  93,  72,  54,  13,   0,  13,  54,  72,  93,
+    116, 141, 166, 191, 214, 232, 246, 253, 253, 246, 232, 214, 191, 166, 141, 116,
+     93,  72,  54,  13,   0,  10,  49,  70,  90, 113, 137, 162, 186, 208, 226, 239,
+    246, 246, 239, 226, 208, 186, 162, 137, 113,  90,  70,  49,  10,   0,   5,  40,
+     66,  85, 107, 130, 153, 176, 197, 214, 226, 232, 232, 226, 214, 197, 176, 153,
+    130, 107,  85,  66,  40,   5,   0,   0,  28,  61,  78,  98, 119, 141, 162, 181,
+    197, 208, 214, 214, 208, 197, 181, 162, 141, 119,  98,  78,  61,  28,   0,   0,
+      0,  15,  54,  70,  88, 107, 126, 145, 162, 176, 186, 191, 191, 186, 176, 162,
+    145, 126, 107,  88,  70,  54,  15,   0,   0,   0,   3,  32,  61,  76,  93, 110,
+    126, 141, 153, 162, 166, 166, 162, 153, 141, 126, 110,  93,  76,  61,  32,   3,
+      0,   0,   0,   0,  13,  45,  64,  78,  93, 107, 119, 130, 137, 141, 141, 137,
+    130, 119, 107,  93,  78,  64,  45,  13,   0,   0,   0,   0,   0,   0,  18,  49,
+     64,  76,  88,  98, 107, 113, 116, 116, 113, 107,  98,  88,  76,  64,  49,  18,
+      0,   0,   0,   0,   0,   0,   0,   0,  18,  45,  61,  70,  78,  85,  90,  93,
+     93,  90,  85,  78,  70,  61,  45,  18,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,  13,  32,  54,  61,  66,  70,  72,  72,  70,  66,  61,  54,  32,  13,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  15,  28,  40,
+     49,  54,  54,  49,  40,  28,  15,   3,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   5,  10,  13,  13,  10,   5,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   9,  12,  13,  11,   7,
+      1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,  12,  25,  37,  47,  53,  54,  51,  43,  32,  19,   6,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   8,  27,  48,  59,  65,  69,  72,  72,
+     71,  67,  62,  56,  37,  17,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     13,  37,  59,  68,  76,  84,  89,  92,  93,  91,  87,  80,  72,  63,  52,  24,
+      3,   0,   0,   0,   0,   0,   0,   0,  12,  41,  62,  73,  85,  96, 105, 111,
+    115, 116, 114, 108, 100,  90,  79,  67,  56,  25,   2,   0,   0,   0,   0,   0,
+      7,  35,  61,  75,  89, 103, 116, 127, 135, 140, 141, 138, 132, 122, 110,  96,
+     82,  68,  54,  20,   0,   0,   0,   0,   0,  24,  57,  72,  88, 105, 122, 137,
+    150, 160, 166, 167, 163, 156, 144, 130, 114,  97,  80,  65,  42,   9,   0,   0,
+      0,   8,  43,  66,  83, 102, 121, 140, 158, 173, 184, 190, 192, 188, 179, 166,
+    149, 131, 111,  92,  74,  58,  24,   0,   0,   0,  20,  57,  74,  93, 114, 135,
+    157, 176, 193, 206, 213, 214, 210, 200, 185, 167, 146, 125, 103,  83,  65,  38,
+      5,   0,   0,  30,  62,  80, 101, 124, 147, 170, 192, 210, 224, 231, 233, 228,
+    217, 201, 181, 159, 135, 112,  90,  71,  52,  12,   0,   3,  37,  66,  85, 107,
+    131, 156, 180, 203, 222, 236, 245, 246, 241, 230, 213, 192, 168, 143, 119,  96,
+     75,  57,  18,   0,   5,  42,  67,  87, 110, 134, 160, 185, 209, 228, 243, 252,
+    253, 248, 236, 219, 197, 173, 147, 122,  98,  77,  59,  21,   0,   5,  42,  67,
+     87, 110, 134, 160, 185, 209, 228, 243, 252, 253, 248, 236, 219, 197, 173, 147,
+    122,  98,  77,  59,  21,   0,   3,  37,  66,  85, 107, 131, 156, 180, 203, 222,
+    236, 245, 246, 241, 230, 213, 192, 168, 143, 119,  96,  75,  57,  18,   0,   0,
+     30,  62,  80, 101, 124, 147, 170, 192, 210, 224, 231, 233, 228, 217, 201, 181,
+    159, 135, 112,  90,  71,  52,  12,   0,   0,  20,  57,  74,  93, 114, 135, 157,
+    176, 193, 206, 213, 214, 210, 200, 185, 167, 146, 125, 103,  83,  65,  38,   5,
+      0,   0,   8,  43,  66,  83, 102, 121, 140, 158, 173, 184, 190, 192, 188, 179,
+    166, 149, 131, 111,  92,  74,  58,  24,   0,   0,   0,   0,  24,  57,  72,  88,
+    105, 122, 137, 150, 160, 166, 167, 163, 156, 144, 130, 114,  97,  80,  65,  42,
+      9,   0,   0,   0,   0,   7,  35,  61,  75,  89, 103, 116, 127, 135, 140, 141,
+    138, 132, 122, 110,  96,  82,  68,  54,  20,   0,   0,   0,   0,   0,   0,  12,
+     41,  62,  73,  85,  96, 105, 111, 115, 116, 114, 108, 100,  90,  79,  67,  56,
+     25,   2,   0,   0,   0,   0,   0,   0,   0,  13,  37,  59,  68,  76,  84,  89,
+     92,  93,  91,  87,  80,  72,  63,  52,  24,   3,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   8,  27,  48,  59,  65,  69,  72,  72,  71,  67,  62,  56,  37,
+     17,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,  25,
+     37,  47,  53,  54,  51,  43,  32,  19,   6,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   9,  12,  13,  11,   7,   1,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   8,  12,  13,  12,
+      8,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   9,  22,  35,  45,  52,  55,  52,  45,  35,  22,   9,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  22,  43,  58,  64,  68,  71,
+     72,  71,  68,  64,  58,  43,  22,   4,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   8,  31,  56,  66,  74,  82,  88,  92,  93,  92,  88,  82,  74,  66,  56,
+     31,   8,   0,   0,   0,   0,   0,   0,   0,   7,  33,  59,  70,  82,  93, 103,
+    110, 115, 116, 115, 110, 103,  93,  82,  70,  59,  33,   7,   0,   0,   0,   0,
+      0,   1,  27,  58,  71,  86, 100, 113, 125, 134, 139, 141, 139, 134, 125, 113,
+    100,  86,  71,  58,  27,   1,   0,   0,   0,   0,  16,  52,  68,  84, 101, 118,
+    134, 147, 158, 165, 167, 165, 158, 147, 134, 118, 101,  84,  68,  52,  16,   0,
+      0,   0,   2,  33,  62,  79,  97, 116, 136, 154, 169, 182, 189, 192, 189, 182,
+    169, 154, 136, 116,  97,  79,  62,  33,   2,   0,   0,  12,  50,  69,  88, 108,
+    130, 152, 172, 189, 203, 212, 215, 212, 203, 189, 172, 152, 130, 108,  88,  69,
+     50,  12,   0,   0,  20,  58,  75,  96, 118, 141, 165, 187, 206, 221, 230, 233,
+    230, 221, 206, 187, 165, 141, 118,  96,  75,  58,  20,   0,   0,  27,  61,  80,
+    101, 125, 149, 174, 197, 218, 233, 243, 247, 243, 233, 218, 197, 174, 149, 125,
+    101,  80,  61,  27,   0,   0,  31,  63,  82, 104, 128, 154, 179, 203, 224, 240,
+    250, 254, 250, 240, 224, 203, 179, 154, 128, 104,  82,  63,  31,   0,   0,  31,
+     63,  82, 104, 128, 154, 179, 203, 224, 240, 250, 254, 250, 240, 224, 203, 179,
+    154, 128, 104,  82,  63,  31,   0,   0,  27,  61,  80, 101, 125, 149, 174, 197,
+    218, 233, 243, 247, 243, 233, 218, 197, 174, 149, 125, 101,  80,  61,  27,   0,
+      0,  20,  58,  75,  96, 118, 141, 165, 187, 206, 221, 230, 233, 230, 221, 206,
+    187, 165, 141, 118,  96,  75,  58,  20,   0,   0,  12,  50,  69,  88, 108, 130,
+    152, 172, 189, 203, 212, 215, 212, 203, 189, 172, 152, 130, 108,  88,  69,  50,
+     12,   0,   0,   2,  33,  62,  79,  97, 116, 136, 154, 169, 182, 189, 192, 189,
+    182, 169, 154, 136, 116,  97,  79,  62,  33,   2,   0,   0,   0,  16,  52,  68,
+     84, 101, 118, 134, 147, 158, 165, 167, 165, 158, 147, 134, 118, 101,  84,  68,
+     52,  16,   0,   0,   0,   0,   1,  27,  58,  71,  86, 100, 113, 125, 134, 139,
+    141, 139, 134, 125, 113, 100,  86,  71,  58,  27,   1,   0,   0,   0,   0,   0,
+      7,  33,  59,  70,  82,  93, 103, 110, 115, 116, 115, 110, 103,  93,  82,  70,
+     59,  33,   7,   0,   0,   0,   0,   0,   0,   0,   8,  31,  56,  66,  74,  82,
+     88,  92,  93,  92,  88,  82,  74,  66,  56,  31,   8,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   4,  22,  43,  58,  64,  68,  71,  72,  71,  68,  64,  58,
+     43,  22,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   9,
+     22,  35,  45,  52,  55,  52,  45,  35,  22,   9,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   8,  12,  13,  12,   8,
+      2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   7,  11,  13,
+     12,   9,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   6,  19,  32,  43,  51,  54,  53,  47,  37,  25,  12,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  17,  37,  56,  62,  67,
+     71,  72,  72,  69,  65,  59,  48,  27,   8,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   3,  24,  52,  63,  72,  80,  87,  91,  93,  92,  89,  84,  76,  68,
+     59,  37,  13,   0,   0,   0,   0,   0,   0,   0,   2,  25,  56,  67,  79,  90,
+    100, 108, 114, 116, 115, 111, 105,  96,  85,  73,  62,  41,  12,   0,   0,   0,
+      0,   0,   0,  20,  54,  68,  82,  96, 110, 122, 132, 138, 141, 140, 135, 127,
+    116, 103,  89,  75,  61,  35,   7,   0,   0,   0,   0,   9,  42,  65,  80,  97,
+    114, 130, 144, 156, 163, 167, 166, 160, 150, 137, 122, 105,  88,  72,  57,  24,
+      0,   0,   0,   0,  24,  58,  74,  92, 111, 131, 149, 166, 179, 188, 192, 190,
+    184, 173, 158, 140, 121, 102,  83,  66,  43,   8,   0,   0,   5,  38,  65,  83,
+    103, 125, 146, 167, 185, 200, 210, 214, 213, 206, 193, 176, 157, 135, 114,  93,
+     74,  57,  20,   0,   0,  12,  52,  71,  90, 112, 135, 159, 181, 201, 217, 228,
+    233, 231, 224, 210, 192, 170, 147, 124, 101,  80,  62,  30,   0,   0,  18,  57,
+     75,  96, 119, 143, 168, 192, 213, 230, 241, 246, 245, 236, 222, 203, 180, 156,
+    131, 107,  85,  66,  37,   3,   0,  21,  59,  77,  98, 122, 147, 173, 197, 219,
+    236, 248, 253, 252, 243, 228, 209, 185, 160, 134, 110,  87,  67,  42,   5,   0,
+     21,  59,  77,  98, 122, 147, 173, 197, 219, 236, 248, 253, 252, 243, 228, 209,
+    185, 160, 134, 110,  87,  67,  42,   5,   0,  18,  57,  75,  96, 119, 143, 168,
+    192, 213, 230, 241, 246, 245, 236, 222, 203, 180, 156, 131, 107,  85,  66,  37,
+      3,   0,  12,  52,  71,  90, 112, 135, 159, 181, 201, 217, 228, 233, 231, 224,
+    210, 192, 170, 147, 124, 101,  80,  62,  30,   0,   0,   5,  38,  65,  83, 103,
+    125, 146, 167, 185, 200, 210, 214, 213, 206, 193, 176, 157, 135, 114,  93,  74,
+     57,  20,   0,   0,   0,  24,  58,  74,  92, 111, 131, 149, 166, 179, 188, 192,
+    190, 184, 173, 158, 140, 121, 102,  83,  66,  43,   8,   0,   0,   0,   9,  42,
+     65,  80,  97, 114, 130, 144, 156, 163, 167, 166, 160, 150, 137, 122, 105,  88,
+     72,  57,  24,   0,   0,   0,   0,   0,  20,  54,  68,  82,  96, 110, 122, 132,
+    138, 141, 140, 135, 127, 116, 103,  89,  75,  61,  35,   7,   0,   0,   0,   0,
+      0,   2,  25,  56,  67,  79,  90, 100, 108, 114, 116, 115, 111, 105,  96,  85,
+     73,  62,  41,  12,   0,   0,   0,   0,   0,   0,   0,   3,  24,  52,  63,  72,
+     80,  87,  91,  93,  92,  89,  84,  76,  68,  59,  37,  13,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   1,  17,  37,  56,  62,  67,  71,  72,  72,  69,  65,
+     59,  48,  27,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      6,  19,  32,  43,  51,  54,  53,  47,  37,  25,  12,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   7,  11,  13,  12,
+      9,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   5,
+      5,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   8,  20,  30,  37,  42,  42,  37,  30,  20,   8,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,  24,  43,  57,  62,
+     66,  67,  67,  66,  62,  57,  43,  24,   7,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,  12,  35,  57,  66,  74,  80,  85,  87,  87,  85,  80,  74,  66,
+     57,  35,  12,   0,   0,   0,   0,   0,   0,   0,   0,  13,  41,  61,  72,  83,
+     93, 101, 107, 110, 110, 107, 101,  93,  83,  72,  61,  41,  13,   0,   0,   0,
+      0,   0,   0,   8,  37,  62,  75,  88, 102, 114, 124, 131, 134, 134, 131, 124,
+    114, 102,  88,  75,  62,  37,   8,   0,   0,   0,   0,   0,  27,  59,  73,  89,
+    105, 121, 135, 147, 156, 160, 160, 156, 147, 135, 121, 105,  89,  73,  59,  27,
+      0,   0,   0,   0,  12,  48,  68,  85, 103, 122, 140, 157, 170, 180, 185, 185,
+    180, 170, 157, 140, 122, 103,  85,  68,  48,  12,   0,   0,   0,  25,  59,  76,
+     96, 116, 137, 158, 176, 192, 203, 209, 209, 203, 192, 176, 158, 137, 116,  96,
+     76,  59,  25,   0,   0,   4,  37,  65,  84, 105, 127, 150, 173, 193, 210, 222,
+    228, 228, 222, 210, 193, 173, 150, 127, 105,  84,  65,  37,   4,   0,   9,  47,
+     69,  89, 111, 135, 160, 184, 206, 224, 236, 243, 243, 236, 224, 206, 184, 160,
+    135, 111,  89,  69,  47,   9,   0,  12,  53,  72,  92, 115, 140, 166, 190, 213,
+    231, 245, 252, 252, 245, 231, 213, 190, 166, 140, 115,  92,  72,  53,  12,   0,
+     13,  54,  72,  93, 116, 141, 167, 192, 214, 233, 246, 253, 253, 246, 233, 214,
+    192, 167, 141, 116,  93,  72,  54,  13,   0,  11,  51,  71,  91, 114, 138, 163,
+    188, 210, 228, 241, 248, 248, 241, 228, 210, 188, 163, 138, 114,  91,  71,  51,
+     11,   0,   7,  43,  67,  87, 108, 132, 156, 179, 200, 217, 230, 236, 236, 230,
+    217, 200, 179, 156, 132, 108,  87,  67,  43,   7,   0,   1,  32,  62,  80, 100,
+    122, 144, 166, 185, 201, 213, 219, 219, 213, 201, 185, 166, 144, 122, 100,  80,
+     62,  32,   1,   0,   0,  19,  56,  72,  90, 110, 130, 149, 167, 181, 192, 197,
+    197, 192, 181, 167, 149, 130, 110,  90,  72,  56,  19,   0,   0,   0,   6,  37,
+     63,  79,  96, 114, 131, 146, 159, 168, 173, 173, 168, 159, 146, 131, 114,  96,
+     79,  63,  37,   6,   0,   0,   0,   0,  17,  52,  67,  82,  97, 111, 125, 135,
+    143, 147, 147, 143, 135, 125, 111,  97,  82,  67,  52,  17,   0,   0,   0,   0,
+      0,   1,  24,  56,  68,  80,  92, 103, 112, 119, 122, 122, 119, 112, 103,  92,
+     80,  68,  56,  24,   1,   0,   0,   0,   0,   0,   0,   3,  25,  54,  65,  74,
+     83,  90,  96,  98,  98,  96,  90,  83,  74,  65,  54,  25,   3,   0,   0,   0,
+      0,   0,   0,   0,   0,   2,  20,  42,  58,  65,  71,  75,  77,  77,  75,  71,
+     65,  58,  42,  20,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      9,  24,  38,  52,  57,  59,  59,  57,  52,  38,  24,   9,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  12,  18,  21,  21,
+     18,  12,   5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,
+      5,   6,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   6,  17,  27,  36,  41,  42,  39,  32,  22,  11,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  19,  38,  56,
+     61,  65,  67,  68,  66,  63,  58,  48,  28,  11,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   7,  29,  55,  64,  72,  79,  84,  87,  87,  86,  82,  76,
+     68,  60,  42,  18,   0,   0,   0,   0,   0,   0,   0,   0,   7,  33,  58,  69,
+     80,  91,  99, 106, 109, 110, 108, 103,  95,  86,  75,  64,  49,  19,   0,   0,
+      0,   0,   0,   0,   3,  29,  58,  71,  85,  98, 111, 121, 129, 134, 135, 132,
+    126, 116, 105,  92,  78,  65,  47,  15,   0,   0,   0,   0,   0,  19,  55,  69,
+     85, 101, 117, 132, 145, 154, 159, 160, 157, 150, 139, 125, 109,  93,  77,  62,
+     36,   6,   0,   0,   0,   6,  38,  64,  80,  98, 117, 136, 153, 167, 178, 184,
+    186, 182, 173, 160, 145, 127, 108,  89,  72,  56,  20,   0,   0,   0,  17,  56,
+     72,  91, 111, 132, 153, 172, 188, 201, 208, 209, 205, 195, 181, 163, 143, 121,
+    101,  81,  63,  35,   3,   0,   0,  27,  61,  79,  99, 121, 145, 167, 188, 206,
+    220, 227, 229, 224, 213, 198, 178, 156, 133, 110,  89,  69,  49,  11,   0,   2,
+     36,  65,  84, 106, 129, 154, 178, 201, 220, 234, 242, 244, 239, 227, 211, 190,
+    166, 142, 117,  94,  74,  56,  17,   0,   5,  41,  67,  87, 109, 134, 159, 184,
+    208, 227, 242, 251, 252, 247, 235, 218, 196, 172, 147, 121,  98,  77,  58,  21,
+      0,   6,  42,  68,  87, 110, 135, 160, 186, 209, 229, 244, 252, 254, 249, 237,
+    220, 198, 173, 148, 122,  98,  77,  59,  21,   0,   4,  39,  66,  86, 108, 132,
+    157, 182, 205, 224, 239, 247, 249, 244, 232, 215, 194, 170, 145, 120,  96,  76,
+     57,  19,   0,   0,  32,  63,  82, 103, 126, 150, 173, 195, 213, 227, 235, 237,
+    232, 221, 205, 184, 162, 138, 114,  92,  72,  55,  14,   0,   0,  22,  58,  76,
+     95, 116, 139, 160, 181, 198, 211, 218, 220, 215, 205, 190, 171, 150, 127, 106,
+     85,  67,  42,   7,   0,   0,  11,  48,  68,  86, 105, 125, 145, 163, 178, 190,
+    196, 198, 194, 184, 171, 154, 135, 115,  95,  77,  60,  27,   0,   0,   0,   0,
+     28,  60,  75,  92, 109, 127, 143, 156, 166, 172, 173, 170, 162, 150, 135, 118,
+    101,  83,  67,  48,  13,   0,   0,   0,   0,  11,  42,  64,  78,  93, 108, 121,
+    133, 142, 147, 148, 145, 138, 127, 115, 101,  86,  71,  57,  25,   0,   0,   0,
+      0,   0,   0,  18,  49,  65,  77,  89, 101, 110, 117, 121, 122, 120, 114, 106,
+     95,  83,  71,  59,  32,   6,   0,   0,   0,   0,   0,   0,   0,  19,  47,  62,
+     72,  81,  89,  94,  98,  98,  96,  92,  85,  77,  67,  57,  32,   8,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,  15,  36,  56,  63,  69,  74,  77,  77,  76,
+     72,  67,  60,  48,  25,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   6,  20,  35,  49,  56,  58,  59,  57,  55,  42,  27,  13,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  11,  17,  21,
+     21,  19,  14,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      1,   5,   6,   5,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   3,  14,  25,  34,  40,  42,  40,  34,  25,  14,
+      3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15,  33,
+     53,  60,  64,  67,  68,  67,  64,  60,  53,  33,  15,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   3,  23,  49,  62,  70,  77,  83,  86,  88,  86,  83,
+     77,  70,  62,  49,  23,   3,   0,   0,   0,   0,   0,   0,   0,   2,  26,  56,
+     67,  78,  88,  97, 104, 109, 110, 109, 104,  97,  88,  78,  67,  56,  26,   2,
+      0,   0,   0,   0,   0,   0,  21,  55,  68,  82,  95, 108, 119, 128, 133, 135,
+    133, 128, 119, 108,  95,  82,  68,  55,  21,   0,   0,   0,   0,   0,  12,  46,
+     66,  81,  97, 113, 129, 142, 152, 158, 161, 158, 152, 142, 129, 113,  97,  81,
+     66,  46,  12,   0,   0,   0,   0,  28,  60,  76,  94, 113, 131, 149, 164, 176,
+    183, 186, 183, 176, 164, 149, 131, 113,  94,  76,  60,  28,   0,   0,   0,   9,
+     46,  68,  86, 106, 127, 148, 167, 185, 198, 206, 209, 206, 198, 185, 167, 148,
+    127, 106,  86,  68,  46,   9,   0,   0,  18,  57,  74,  94, 116, 139, 162, 183,
+    202, 217, 226, 229, 226, 217, 202, 183, 162, 139, 116,  94,  74,  57,  18,   0,
+      0,  26,  60,  79, 100, 123, 148, 172, 195, 215, 231, 241, 244, 241, 231, 215,
+    195, 172, 148, 123, 100,  79,  60,  26,   0,   0,  30,  63,  82, 104, 128, 153,
+    178, 202, 223, 239, 249, 253, 249, 239, 223, 202, 178, 153, 128, 104,  82,  63,
+     30,   0,   0,  31,  63,  82, 104, 129, 154, 180, 204, 224, 241, 251, 254, 251,
+    241, 224, 204, 180, 154, 129, 104,  82,  63,  31,   0,   0,  28,  62,  81, 102,
+    126, 151, 176, 199, 220, 236, 246, 249, 246, 236, 220, 199, 176, 151, 126, 102,
+     81,  62,  28,   0,   0,  22,  59,  77,  97, 120, 144, 167, 190, 209, 224, 234,
+    237, 234, 224, 209, 190, 167, 144, 120,  97,  77,  59,  22,   0,   0,  14,  54,
+     71,  90, 111, 133, 155, 176, 194, 208, 217, 220, 217, 208, 194, 176, 155, 133,
+    111,  90,  71,  54,  14,   0,   0,   5,  37,  64,  81, 100, 120, 140, 158, 175,
+    187, 195, 198, 195, 187, 175, 158, 140, 120, 100,  81,  64,  37,   5,   0,   0,
+      0,  20,  56,  71,  88, 105, 122, 139, 153, 164, 171, 173, 171, 164, 153, 139,
+    122, 105,  88,  71,  56,  20,   0,   0,   0,   0,   5,  33,  60,  75,  89, 104,
+    118, 130, 140, 146, 148, 146, 140, 130, 118, 104,  89,  75,  60,  33,   5,   0,
+      0,   0,   0,   0,  11,  40,  62,  74,  86,  98, 108, 116, 121, 122, 121, 116,
+    108,  98,  86,  74,  62,  40,  11,   0,   0,   0,   0,   0,   0,   0,  13,  39,
+     60,  70,  79,  87,  93,  97,  99,  97,  93,  87,  79,  70,  60,  39,  13,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,  10,  30,  54,  62,  68,  73,  76,  77,
+     76,  73,  68,  62,  54,  30,  10,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   2,  16,  31,  46,  56,  58,  59,  58,  56,  46,  31,  16,   2,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   9,  15,
+     20,  21,  20,  15,   9,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   4,   6,   5,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,  11,  22,  32,  39,  42,  41,  36,  27,
+     17,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11,
+     28,  48,  58,  63,  66,  68,  67,  65,  61,  56,  38,  19,   3,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,  18,  42,  60,  68,  76,  82,  86,  87,  87,
+     84,  79,  72,  64,  55,  29,   7,   0,   0,   0,   0,   0,   0,   0,   0,  19,
+     49,  64,  75,  86,  95, 103, 108, 110, 109, 106,  99,  91,  80,  69,  58,  33,
+      7,   0,   0,   0,   0,   0,   0,  15,  47,  65,  78,  92, 105, 116, 126, 132,
+    135, 134, 129, 121, 111,  98,  85,  71,  58,  29,   3,   0,   0,   0,   0,   6,
+     36,  62,  77,  93, 109, 125, 139, 150, 157, 160, 159, 154, 145, 132, 117, 101,
+     85,  69,  55,  19,   0,   0,   0,   0,  20,  56,  72,  89, 108, 127, 145, 160,
+    173, 182, 186, 184, 178, 167, 153, 136, 117,  98,  80,  64,  38,   6,   0,   0,
+      3,  35,  63,  81, 101, 121, 143, 163, 181, 195, 205, 209, 208, 201, 188, 172,
+    153, 132, 111,  91,  72,  56,  17,   0,   0,  11,  49,  69,  89, 110, 133, 156,
+    178, 198, 213, 224, 229, 227, 220, 206, 188, 167, 145, 121,  99,  79,  61,  27,
+      0,   0,  17,  56,  74,  94, 117, 142, 166, 190, 211, 227, 239, 244, 242, 234,
+    220, 201, 178, 154, 129, 106,  84,  65,  36,   2,   0,  21,  58,  77,  98, 121,
+    147, 172, 196, 218, 235, 247, 252, 251, 242, 227, 208, 184, 159, 134, 109,  87,
+     67,  41,   5,   0,  21,  59,  77,  98, 122, 148, 173, 198, 220, 237, 249, 254,
+    252, 244, 229, 209, 186, 160, 135, 110,  87,  68,  42,   6,   0,  19,  57,  76,
+     96, 120, 145, 170, 194, 215, 232, 244, 249, 247, 239, 224, 205, 182, 157, 132,
+    108,  86,  66,  39,   4,   0,  14,  55,  72,  92, 114, 138, 162, 184, 205, 221,
+    232, 237, 235, 227, 213, 195, 173, 150, 126, 103,  82,  63,  32,   0,   0,   7,
+     42,  67,  85, 106, 127, 150, 171, 190, 205, 215, 220, 218, 211, 198, 181, 160,
+    139, 116,  95,  76,  58,  22,   0,   0,   0,  27,  60,  77,  95, 115, 135, 154,
+    171, 184, 194, 198, 196, 190, 178, 163, 145, 125, 105,  86,  68,  48,  11,   0,
+      0,   0,  13,  48,  67,  83, 101, 118, 135, 150, 162, 170, 173, 172, 166, 156,
+    143, 127, 109,  92,  75,  60,  28,   0,   0,   0,   0,   0,  25,  57,  71,  86,
+    101, 115, 127, 138, 145, 148, 147, 142, 133, 121, 108,  93,  78,  64,  42,  11,
+      0,   0,   0,   0,   0,   6,  32,  59,  71,  83,  95, 106, 114, 120, 122, 121,
+    117, 110, 101,  89,  77,  65,  49,  18,   0,   0,   0,   0,   0,   0,   0,   8,
+     32,  57,  67,  77,  85,  92,  96,  98,  98,  94,  89,  81,  72,  62,  47,  19,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  25,  48,  60,  67,  72,  76,
+     77,  77,  74,  69,  63,  56,  36,  15,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  13,  27,  42,  55,  57,  59,  58,  56,  49,  35,  20,   6,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,
+     14,  19,  21,  21,  17,  11,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   2,  12,  20,  27,  31,  31,  27,  20,
+     12,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+     16,  33,  50,  58,  61,  63,  63,  61,  58,  50,  33,  16,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   7,  27,  52,  62,  69,  75,  80,  82,  82,
+     80,  75,  69,  62,  52,  27,   7,   0,   0,   0,   0,   0,   0,   0,   0,   8,
+     33,  58,  68,  79,  88,  96, 101, 104, 104, 101,  96,  88,  79,  68,  58,  33,
+      8,   0,   0,   0,   0,   0,   0,   4,  31,  59,  71,  84,  97, 108, 118, 125,
+    128, 128, 125, 118, 108,  97,  84,  71,  59,  31,   4,   0,   0,   0,   0,   0,
+     22,  56,  70,  86, 101, 116, 130, 141, 149, 154, 154, 149, 141, 130, 116, 101,
+     86,  70,  56,  22,   0,   0,   0,   0,   9,  43,  66,  82, 100, 118, 136, 152,
+    165, 174, 179, 179, 174, 165, 152, 136, 118, 100,  82,  66,  43,   9,   0,   0,
+      0,  22,  58,  74,  93, 113, 134, 154, 172, 187, 197, 203, 203, 197, 187, 172,
+    154, 134, 113,  93,  74,  58,  22,   0,   0,   2,  35,  64,  82, 103, 125, 147,
+    169, 189, 206, 218, 224, 224, 218, 206, 189, 169, 147, 125, 103,  82,  64,  35,
+      2,   0,   8,  45,  68,  88, 110, 134, 158, 182, 203, 221, 233, 240, 240, 233,
+    221, 203, 182, 158, 134, 110,  88,  68,  45,   8,   0,  12,  52,  71,  92, 115,
+    139, 165, 189, 212, 230, 243, 250, 250, 243, 230, 212, 189, 165, 139, 115,  92,
+     71,  52,  12,   0,  13,  55,  72,  93, 116, 141, 167, 192, 215, 233, 247, 254,
+    254, 247, 233, 215, 192, 167, 141, 116,  93,  72,  55,  13,   0,  12,  52,  71,
+     92, 115, 139, 165, 189, 212, 230, 243, 250, 250, 243, 230, 212, 189, 165, 139,
+    115,  92,  71,  52,  12,   0,   8,  45,  68,  88, 110, 134, 158, 182, 203, 221,
+    233, 240, 240, 233, 221, 203, 182, 158, 134, 110,  88,  68,  45,   8,   0,   2,
+     35,  64,  82, 103, 125, 147, 169, 189, 206, 218, 224, 224, 218, 206, 189, 169,
+    147, 125, 103,  82,  64,  35,   2,   0,   0,  22,  58,  74,  93, 113, 134, 154,
+    172, 187, 197, 203, 203, 197, 187, 172, 154, 134, 113,  93,  74,  58,  22,   0,
+      0,   0,   9,  43,  66,  82, 100, 118, 136, 152, 165, 174, 179, 179, 174, 165,
+    152, 136, 118, 100,  82,  66,  43,   9,   0,   0,   0,   0,  22,  56,  70,  86,
+    101, 116, 130, 141, 149, 154, 154, 149, 141, 130, 116, 101,  86,  70,  56,  22,
+      0,   0,   0,   0,   0,   4,  31,  59,  71,  84,  97, 108, 118, 125, 128, 128,
+    125, 118, 108,  97,  84,  71,  59,  31,   4,   0,   0,   0,   0,   0,   0,   8,
+     33,  58,  68,  79,  88,  96, 101, 104, 104, 101,  96,  88,  79,  68,  58,  33,
+      8,   0,   0,   0,   0,   0,   0,   0,   0,   7,  27,  52,  62,  69,  75,  80,
+     82,  82,  80,  75,  69,  62,  52,  27,   7,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   1,  16,  33,  50,  58,  61,  63,  63,  61,  58,  50,  33,  16,
+      1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  12,
+     20,  27,  31,  31,  27,  20,  12,   2,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   9,  18,  26,  30,  31,  28,
+     22,  14,   5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,  12,  28,  46,  57,  60,  63,  63,  62,  59,  54,  37,  20,   5,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   2,  21,  46,  60,  68,  74,  79,  82,
+     82,  81,  77,  71,  64,  56,  33,  11,   0,   0,   0,   0,   0,   0,   0,   0,
+      3,  26,  55,  66,  76,  86,  94, 100, 104, 104, 102,  97,  90,  81,  71,  60,
+     40,  13,   0,   0,   0,   0,   0,   0,   0,  23,  56,  68,  81,  94, 106, 116,
+    123, 128, 129, 126, 120, 111, 100,  88,  75,  62,  39,  10,   0,   0,   0,   0,
+      0,  15,  49,  67,  82,  97, 113, 127, 139, 148, 153, 154, 151, 144, 133, 120,
+    105,  89,  74,  60,  30,   2,   0,   0,   0,   3,  33,  62,  78,  95, 113, 131,
+    148, 162, 172, 178, 180, 176, 167, 155, 140, 122, 104,  86,  70,  54,  16,   0,
+      0,   0,  14,  53,  70,  88, 108, 129, 149, 167, 183, 195, 202, 204, 199, 190,
+    176, 158, 139, 118,  98,  79,  62,  31,   1,   0,   0,  25,  60,  77,  97, 119,
+    142, 164, 185, 202, 215, 223, 224, 220, 209, 194, 175, 153, 130, 108,  87,  68,
+     46,   9,   0,   1,  34,  64,  83, 104, 128, 152, 176, 198, 217, 231, 239, 241,
+    236, 224, 208, 187, 164, 140, 116,  93,  73,  56,  15,   0,   5,  40,  67,  86,
+    109, 133, 158, 183, 206, 226, 241, 249, 251, 246, 234, 217, 195, 171, 146, 121,
+     97,  76,  58,  20,   0,   6,  42,  68,  88, 110, 135, 161, 186, 209, 229, 244,
+    253, 254, 249, 237, 220, 198, 173, 148, 122,  99,  77,  59,  21,   0,   5,  40,
+     67,  86, 109, 133, 158, 183, 206, 226, 241, 249, 251, 246, 234, 217, 195, 171,
+    146, 121,  97,  76,  58,  20,   0,   1,  34,  64,  83, 104, 128, 152, 176, 198,
+    217, 231, 239, 241, 236, 224, 208, 187, 164, 140, 116,  93,  73,  56,  15,   0,
+      0,  25,  60,  77,  97, 119, 142, 164, 185, 202, 215, 223, 224, 220, 209, 194,
+    175, 153, 130, 108,  87,  68,  46,   9,   0,   0,  14,  53,  70,  88, 108, 129,
+    149, 167, 183, 195, 202, 204, 199, 190, 176, 158, 139, 118,  98,  79,  62,  31,
+      1,   0,   0,   3,  33,  62,  78,  95, 113, 131, 148, 162, 172, 178, 180, 176,
+    167, 155, 140, 122, 104,  86,  70,  54,  16,   0,   0,   0,   0,  15,  49,  67,
+     82,  97, 113, 127, 139, 148, 153, 154, 151, 144, 133, 120, 105,  89,  74,  60,
+     30,   2,   0,   0,   0,   0,   0,  23,  56,  68,  81,  94, 106, 116, 123, 128,
+    129, 126, 120, 111, 100,  88,  75,  62,  39,  10,   0,   0,   0,   0,   0,   0,
+      3,  26,  55,  66,  76,  86,  94, 100, 104, 104, 102,  97,  90,  81,  71,  60,
+     40,  13,   0,   0,   0,   0,   0,   0,   0,   0,   2,  21,  46,  60,  68,  74,
+     79,  82,  82,  81,  77,  71,  64,  56,  33,  11,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,  12,  28,  46,  57,  60,  63,  63,  62,  59,  54,  37,
+     20,   5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      9,  18,  26,  30,  31,  28,  22,  14,   5,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,  16,  24,  29,  31,
+     29,  24,  16,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   8,  24,  41,  56,  60,  62,  63,  62,  60,  56,  41,  24,   8,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,  39,  58,  66,  73,  78,
+     81,  82,  81,  78,  73,  66,  58,  39,  16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,  19,  48,  63,  74,  83,  92,  99, 103, 104, 103,  99,  92,  83,  74,
+     63,  48,  19,   0,   0,   0,   0,   0,   0,   0,  16,  48,  65,  78,  91, 103,
+    113, 122, 127, 129, 127, 122, 113, 103,  91,  78,  65,  48,  16,   0,   0,   0,
+      0,   0,   8,  39,  63,  78,  93, 109, 123, 136, 146, 152, 154, 152, 146, 136,
+    123, 109,  93,  78,  63,  39,   8,   0,   0,   0,   0,  24,  58,  74,  91, 109,
+    127, 144, 159, 170, 177, 180, 177, 170, 159, 144, 127, 109,  91,  74,  58,  24,
+      0,   0,   0,   7,  41,  66,  83, 103, 123, 144, 163, 180, 193, 201, 204, 201,
+    193, 180, 163, 144, 123, 103,  83,  66,  41,   7,   0,   0,  16,  56,  73,  92,
+    113, 136, 159, 180, 198, 212, 221, 225, 221, 212, 198, 180, 159, 136, 113,  92,
+     73,  56,  16,   0,   0,  24,  60,  78,  99, 122, 146, 170, 193, 212, 228, 237,
+    241, 237, 228, 212, 193, 170, 146, 122,  99,  78,  60,  24,   0,   0,  29,  62,
+     81, 103, 127, 152, 177, 201, 221, 237, 248, 251, 248, 237, 221, 201, 177, 152,
+    127, 103,  81,  62,  29,   0,   0,  31,  63,  82, 104, 129, 154, 180, 204, 225,
+    241, 251, 255, 251, 241, 225, 204, 180, 154, 129, 104,  82,  63,  31,   0,   0,
+     29,  62,  81, 103, 127, 152, 177, 201, 221, 237, 248, 251, 248, 237, 221, 201,
+    177, 152, 127, 103,  81,  62,  29,   0,   0,  24,  60,  78,  99, 122, 146, 170,
+    193, 212, 228, 237, 241, 237, 228, 212, 193, 170, 146, 122,  99,  78,  60,  24,
+      0,   0,  16,  56,  73,  92, 113, 136, 159, 180, 198, 212, 221, 225, 221, 212,
+    198, 180, 159, 136, 113,  92,  73,  56,  16,   0,   0,   7,  41,  66,  83, 103,
+    123, 144, 163, 180, 193, 201, 204, 201, 193, 180, 163, 144, 123, 103,  83,  66,
+     41,   7,   0,   0,   0,  24,  58,  74,  91, 109, 127, 144, 159, 170, 177, 180,
+    177, 170, 159, 144, 127, 109,  91,  74,  58,  24,   0,   0,   0,   0,   8,  39,
+     63,  78,  93, 109, 123, 136, 146, 152, 154, 152, 146, 136, 123, 109,  93,  78,
+     63,  39,   8,   0,   0,   0,   0,   0,  16,  48,  65,  78,  91, 103, 113, 122,
+    127, 129, 127, 122, 113, 103,  91,  78,  65,  48,  16,   0,   0,   0,   0,   0,
+      0,   0,  19,  48,  63,  74,  83,  92,  99, 103, 104, 103,  99,  92,  83,  74,
+     63,  48,  19,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,  39,  58,  66,
+     73,  78,  81,  82,  81,  78,  73,  66,  58,  39,  16,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   8,  24,  41,  56,  60,  62,  63,  62,  60,  56,
+     41,  24,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   7,  16,  24,  29,  31,  29,  24,  16,   7,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  14,  22,  28,
+     31,  30,  26,  18,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   5,  20,  37,  54,  59,  62,  63,  63,  60,  57,  46,  28,  12,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11,  33,  56,  64,  71,
+     77,  81,  82,  82,  79,  74,  68,  60,  46,  21,   2,   0,   0,   0,   0,   0,
+      0,   0,   0,  13,  40,  60,  71,  81,  90,  97, 102, 104, 104, 100,  94,  86,
+     76,  66,  55,  26,   3,   0,   0,   0,   0,   0,   0,  10,  39,  62,  75,  88,
+    100, 111, 120, 126, 129, 128, 123, 116, 106,  94,  81,  68,  56,  23,   0,   0,
+      0,   0,   0,   2,  30,  60,  74,  89, 105, 120, 133, 144, 151, 154, 153, 148,
+    139, 127, 113,  97,  82,  67,  49,  15,   0,   0,   0,   0,  16,  54,  70,  86,
+    104, 122, 140, 155, 167, 176, 180, 178, 172, 162, 148, 131, 113,  95,  78,  62,
+     33,   3,   0,   0,   1,  31,  62,  79,  98, 118, 139, 158, 176, 190, 199, 204,
+    202, 195, 183, 167, 149, 129, 108,  88,  70,  53,  14,   0,   0,   9,  46,  68,
+     87, 108, 130, 153, 175, 194, 209, 220, 224, 223, 215, 202, 185, 164, 142, 119,
+     97,  77,  60,  25,   0,   0,  15,  56,  73,  93, 116, 140, 164, 187, 208, 224,
+    236, 241, 239, 231, 217, 198, 176, 152, 128, 104,  83,  64,  34,   1,   0,  20,
+     58,  76,  97, 121, 146, 171, 195, 217, 234, 246, 251, 249, 241, 226, 206, 183,
+    158, 133, 109,  86,  67,  40,   5,   0,  21,  59,  77,  99, 122, 148, 173, 198,
+    220, 237, 249, 254, 253, 244, 229, 209, 186, 161, 135, 110,  88,  68,  42,   6,
+      0,  20,  58,  76,  97, 121, 146, 171, 195, 217, 234, 246, 251, 249, 241, 226,
+    206, 183, 158, 133, 109,  86,  67,  40,   5,   0,  15,  56,  73,  93, 116, 140,
+    164, 187, 208, 224, 236, 241, 239, 231, 217, 198, 176, 152, 128, 104,  83,  64,
+     34,   1,   0,   9,  46,  68,  87, 108, 130, 153, 175, 194, 209, 220, 224, 223,
+    215, 202, 185, 164, 142, 119,  97,  77,  60,  25,   0,   0,   1,  31,  62,  79,
+     98, 118, 139, 158, 176, 190, 199, 204, 202, 195, 183, 167, 149, 129, 108,  88,
+     70,  53,  14,   0,   0,   0,  16,  54,  70,  86, 104, 122, 140, 155, 167, 176,
+    180, 178, 172, 162, 148, 131, 113,  95,  78,  62,  33,   3,   0,   0,   0,   2,
+     30,  60,  74,  89, 105, 120, 133, 144, 151, 154, 153, 148, 139, 127, 113,  97,
+     82,  67,  49,  15,   0,   0,   0,   0,   0,  10,  39,  62,  75,  88, 100, 111,
+    120, 126, 129, 128, 123, 116, 106,  94,  81,  68,  56,  23,   0,   0,   0,   0,
+      0,   0,   0,  13,  40,  60,  71,  81,  90,  97, 102, 104, 104, 100,  94,  86,
+     76,  66,  55,  26,   3,   0,   0,   0,   0,   0,   0,   0,   0,  11,  33,  56,
+     64,  71,  77,  81,  82,  82,  79,  74,  68,  60,  46,  21,   2,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   5,  20,  37,  54,  59,  62,  63,  63,  60,
+     57,  46,  28,  12,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   5,  14,  22,  28,  31,  30,  26,  18,   9,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  12,  18,
+     21,  21,  18,  12,   5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   9,  24,  38,  52,  57,  59,  59,  57,  52,  38,  24,   9,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  20,  42,  58,  65,
+     71,  75,  77,  77,  75,  71,  65,  58,  42,  20,   2,   0,   0,   0,   0,   0,
+      0,   0,   0,   3,  25,  54,  65,  74,  83,  90,  96,  98,  98,  96,  90,  83,
+     74,  65,  54,  25,   3,   0,   0,   0,   0,   0,   0,   1,  24,  56,  68,  80,
+     92, 103, 112, 119, 122, 122, 119, 112, 103,  92,  80,  68,  56,  24,   1,   0,
+      0,   0,   0,   0,  17,  52,  67,  82,  97, 111, 125, 135, 143, 147, 147, 143,
+    135, 125, 111,  97,  82,  67,  52,  17,   0,   0,   0,   0,   6,  37,  63,  79,
+     96, 114, 131, 146, 159, 168, 173, 173, 168, 159, 146, 131, 114,  96,  79,  63,
+     37,   6,   0,   0,   0,  19,  56,  72,  90, 110, 130, 149, 167, 181, 192, 197,
+    197, 192, 181, 167, 149, 130, 110,  90,  72,  56,  19,   0,   0,   1,  32,  62,
+     80, 100, 122, 144, 166, 185, 201, 213, 219, 219, 213, 201, 185, 166, 144, 122,
+    100,  80,  62,  32,   1,   0,   7,  43,  67,  87, 108, 132, 156, 179, 200, 217,
+    230, 236, 236, 230, 217, 200, 179, 156, 132, 108,  87,  67,  43,   7,   0,  11,
+     51,  71,  91, 114, 138, 163, 188, 210, 228, 241, 248, 248, 241, 228, 210, 188,
+    163, 138, 114,  91,  71,  51,  11,   0,  13,  54,  72,  93, 116, 141, 167, 192,
+    214, 233, 246, 253, 253, 246, 233, 214, 192, 167, 141, 116,  93,  72,  54,  13,
+      0,  12,  53,  72,  92, 115, 140, 166, 190, 213, 231, 245, 252, 252, 245, 231,
+    213, 190, 166, 140, 115,  92,  72,  53,  12,   0,   9,  47,  69,  89, 111, 135,
+    160, 184, 206, 224, 236, 243, 243, 236, 224, 206, 184, 160, 135, 111,  89,  69,
+     47,   9,   0,   4,  37,  65,  84, 105, 127, 150, 173, 193, 210, 222, 228, 228,
+    222, 210, 193, 173, 150, 127, 105,  84,  65,  37,   4,   0,   0,  25,  59,  76,
+     96, 116, 137, 158, 176, 192, 203, 209, 209, 203, 192, 176, 158, 137, 116,  96,
+     76,  59,  25,   0,   0,   0,  12,  48,  68,  85, 103, 122, 140, 157, 170, 180,
+    185, 185, 180, 170, 157, 140, 122, 103,  85,  68,  48,  12,   0,   0,   0,   0,
+     27,  59,  73,  89, 105, 121, 135, 147, 156, 160, 160, 156, 147, 135, 121, 105,
+     89,  73,  59,  27,   0,   0,   0,   0,   0,   8,  37,  62,  75,  88, 102, 114,
+    124, 131, 134, 134, 131, 124, 114, 102,  88,  75,  62,  37,   8,   0,   0,   0,
+      0,   0,   0,  13,  41,  61,  72,  83,  93, 101, 107, 110, 110, 107, 101,  93,
+     83,  72,  61,  41,  13,   0,   0,   0,   0,   0,   0,   0,   0,  12,  35,  57,
+     66,  74,  80,  85,  87,  87,  85,  80,  74,  66,  57,  35,  12,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   7,  24,  43,  57,  62,  66,  67,  67,  66,
+     62,  57,  43,  24,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   8,  20,  30,  37,  42,  42,  37,  30,  20,   8,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   5,
+      5,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  11,
+     17,  21,  21,  19,  14,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   6,  20,  35,  49,  56,  58,  59,  57,  55,  42,  27,
+     13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15,  36,  56,
+     63,  69,  74,  77,  77,  76,  72,  67,  60,  48,  25,   6,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,  19,  47,  62,  72,  81,  89,  94,  98,  98,  96,  92,
+     85,  77,  67,  57,  32,   8,   0,   0,   0,   0,   0,   0,   0,  18,  49,  65,
+     77,  89, 101, 110, 117, 121, 122, 120, 114, 106,  95,  83,  71,  59,  32,   6,
+      0,   0,   0,   0,   0,  11,  42,  64,  78,  93, 108, 121, 133, 142, 147, 148,
+    145, 138, 127, 115, 101,  86,  71,  57,  25,   0,   0,   0,   0,   0,  28,  60,
+     75,  92, 109, 127, 143, 156, 166, 172, 173, 170, 162, 150, 135, 118, 101,  83,
+     67,  48,  13,   0,   0,   0,  11,  48,  68,  86, 105, 125, 145, 163, 178, 190,
+    196, 198, 194, 184, 171, 154, 135, 115,  95,  77,  60,  27,   0,   0,   0,  22,
+     58,  76,  95, 116, 139, 160, 181, 198, 211, 218, 220, 215, 205, 190, 171, 150,
+    127, 106,  85,  67,  42,   7,   0,   0,  32,  63,  82, 103, 126, 150, 173, 195,
+    213, 227, 235, 237, 232, 221, 205, 184, 162, 138, 114,  92,  72,  55,  14,   0,
+      4,  39,  66,  86, 108, 132, 157, 182, 205, 224, 239, 247, 249, 244, 232, 215,
+    194, 170, 145, 120,  96,  76,  57,  19,   0,   6,  42,  68,  87, 110, 135, 160,
+    186, 209, 229, 244, 252, 254, 249, 237, 220, 198, 173, 148, 122,  98,  77,  59,
+     21,   0,   5,  41,  67,  87, 109, 134, 159, 184, 208, 227, 242, 251, 252, 247,
+    235, 218, 196, 172, 147, 121,  98,  77,  58,  21,   0,   2,  36,  65,  84, 106,
+    129, 154, 178, 201, 220, 234, 242, 244, 239, 227, 211, 190, 166, 142, 117,  94,
+     74,  56,  17,   0,   0,  27,  61,  79,  99, 121, 145, 167, 188, 206, 220, 227,
+    229, 224, 213, 198, 178, 156, 133, 110,  89,  69,  49,  11,   0,   0,  17,  56,
+     72,  91, 111, 132, 153, 172, 188, 201, 208, 209, 205, 195, 181, 163, 143, 121,
+    101,  81,  63,  35,   3,   0,   0,   6,  38,  64,  80,  98, 117, 136, 153, 167,
+    178, 184, 186, 182, 173, 160, 145, 127, 108,  89,  72,  56,  20,   0,   0,   0,
+      0,  19,  55,  69,  85, 101, 117, 132, 145, 154, 159, 160, 157, 150, 139, 125,
+    109,  93,  77,  62,  36,   6,   0,   0,   0,   0,   3,  29,  58,  71,  85,  98,
+    111, 121, 129, 134, 135, 132, 126, 116, 105,  92,  78,  65,  47,  15,   0,   0,
+      0,   0,   0,   0,   7,  33,  58,  69,  80,  91,  99, 106, 109, 110, 108, 103,
+     95,  86,  75,  64,  49,  19,   0,   0,   0,   0,   0,   0,   0,   0,   7,  29,
+     55,  64,  72,  79,  84,  87,  87,  86,  82,  76,  68,  60,  42,  18,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   3,  19,  38,  56,  61,  65,  67,  68,
+     66,  63,  58,  48,  28,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   6,  17,  27,  36,  41,  42,  39,  32,  22,  11,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,
+      5,   6,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+      9,  15,  20,  21,  20,  15,   9,   1,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   2,  16,  31,  46,  56,  58,  59,  58,  56,  46,
+     31,  16,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  10,  30,
+     54,  62,  68,  73,  76,  77,  76,  73,  68,  62,  54,  30,  10,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,  13,  39,  60,  70,  79,  87,  93,  97,  99,  97,
+     93,  87,  79,  70,  60,  39,  13,   0,   0,   0,   0,   0,   0,   0,  11,  40,
+     62,  74,  86,  98, 108, 116, 121, 122, 121, 116, 108,  98,  86,  74,  62,  40,
+     11,   0,   0,   0,   0,   0,   5,  33,  60,  75,  89, 104, 118, 130, 140, 146,
+    148, 146, 140, 130, 118, 104,  89,  75,  60,  33,   5,   0,   0,   0,   0,  20,
+     56,  71,  88, 105, 122, 139, 153, 164, 171, 173, 171, 164, 153, 139, 122, 105,
+     88,  71,  56,  20,   0,   0,   0,   5,  37,  64,  81, 100, 120, 140, 158, 175,
+    187, 195, 198, 195, 187, 175, 158, 140, 120, 100,  81,  64,  37,   5,   0,   0,
+     14,  54,  71,  90, 111, 133, 155, 176, 194, 208, 217, 220, 217, 208, 194, 176,
+    155, 133, 111,  90,  71,  54,  14,   0,   0,  22,  59,  77,  97, 120, 144, 167,
+    190, 209, 224, 234, 237, 234, 224, 209, 190, 167, 144, 120,  97,  77,  59,  22,
+      0,   0,  28,  62,  81, 102, 126, 151, 176, 199, 220, 236, 246, 249, 246, 236,
+    220, 199, 176, 151, 126, 102,  81,  62,  28,   0,   0,  31,  63,  82, 104, 129,
+    154, 180, 204, 224, 241, 251, 254, 251, 241, 224, 204, 180, 154, 129, 104,  82,
+     63,  31,   0,   0,  30,  63,  82, 104, 128, 153, 178, 202, 223, 239, 249, 253,
+    249, 239, 223, 202, 178, 153, 128, 104,  82,  63,  30,   0,   0,  26,  60,  79,
+    100, 123, 148, 172, 195, 215, 231, 241, 244, 241, 231, 215, 195, 172, 148, 123,
+    100,  79,  60,  26,   0,   0,  18,  57,  74,  94, 116, 139, 162, 183, 202, 217,
+    226, 229, 226, 217, 202, 183, 162, 139, 116,  94,  74,  57,  18,   0,   0,   9,
+     46,  68,  86, 106, 127, 148, 167, 185, 198, 206, 209, 206, 198, 185, 167, 148,
+    127, 106,  86,  68,  46,   9,   0,   0,   0,  28,  60,  76,  94, 113, 131, 149,
+    164, 176, 183, 186, 183, 176, 164, 149, 131, 113,  94,  76,  60,  28,   0,   0,
+      0,   0,  12,  46,  66,  81,  97, 113, 129, 142, 152, 158, 161, 158, 152, 142,
+    129, 113,  97,  81,  66,  46,  12,   0,   0,   0,   0,   0,  21,  55,  68,  82,
+     95, 108, 119, 128, 133, 135, 133, 128, 119, 108,  95,  82,  68,  55,  21,   0,
+      0,   0,   0,   0,   0,   2,  26,  56,  67,  78,  88,  97, 104, 109, 110, 109,
+    104,  97,  88,  78,  67,  56,  26,   2,   0,   0,   0,   0,   0,   0,   0,   3,
+     23,  49,  62,  70,  77,  83,  86,  88,  86,  83,  77,  70,  62,  49,  23,   3,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15,  33,  53,  60,  64,  67,
+     68,  67,  64,  60,  53,  33,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,  14,  25,  34,  40,  42,  40,  34,  25,  14,   3,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      1,   5,   6,   5,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   7,  14,  19,  21,  21,  17,  11,   3,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,  13,  27,  42,  55,  57,  59,  58,  56,
+     49,  35,  20,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,
+     25,  48,  60,  67,  72,  76,  77,  77,  74,  69,  63,  56,  36,  15,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   8,  32,  57,  67,  77,  85,  92,  96,  98,
+     98,  94,  89,  81,  72,  62,  47,  19,   0,   0,   0,   0,   0,   0,   0,   6,
+     32,  59,  71,  83,  95, 106, 114, 120, 122, 121, 117, 110, 101,  89,  77,  65,
+     49,  18,   0,   0,   0,   0,   0,   0,  25,  57,  71,  86, 101, 115, 127, 138,
+    145, 148, 147, 142, 133, 121, 108,  93,  78,  64,  42,  11,   0,   0,   0,   0,
+     13,  48,  67,  83, 101, 118, 135, 150, 162, 170, 173, 172, 166, 156, 143, 127,
+    109,  92,  75,  60,  28,   0,   0,   0,   0,  27,  60,  77,  95, 115, 135, 154,
+    171, 184, 194, 198, 196, 190, 178, 163, 145, 125, 105,  86,  68,  48,  11,   0,
+      0,   7,  42,  67,  85, 106, 127, 150, 171, 190, 205, 215, 220, 218, 211, 198,
+    181, 160, 139, 116,  95,  76,  58,  22,   0,   0,  14,  55,  72,  92, 114, 138,
+    162, 184, 205, 221, 232, 237, 235, 227, 213, 195, 173, 150, 126, 103,  82,  63,
+     32,   0,   0,  19,  57,  76,  96, 120, 145, 170, 194, 215, 232, 244, 249, 247,
+    239, 224, 205, 182, 157, 132, 108,  86,  66,  39,   4,   0,  21,  59,  77,  98,
+    122, 148, 173, 198, 220, 237, 249, 254, 252, 244, 229, 209, 186, 160, 135, 110,
+     87,  68,  42,   6,   0,  21,  58,  77,  98, 121, 147, 172, 196, 218, 235, 247,
+    252, 251, 242, 227, 208, 184, 159, 134, 109,  87,  67,  41,   5,   0,  17,  56,
+     74,  94, 117, 142, 166, 190, 211, 227, 239, 244, 242, 234, 220, 201, 178, 154,
+    129, 106,  84,  65,  36,   2,   0,  11,  49,  69,  89, 110, 133, 156, 178, 198,
+    213, 224, 229, 227, 220, 206, 188, 167, 145, 121,  99,  79,  61,  27,   0,   0,
+      3,  35,  63,  81, 101, 121, 143, 163, 181, 195, 205, 209, 208, 201, 188, 172,
+    153, 132, 111,  91,  72,  56,  17,   0,   0,   0,  20,  56,  72,  89, 108, 127,
+    145, 160, 173, 182, 186, 184, 178, 167, 153, 136, 117,  98,  80,  64,  38,   6,
+      0,   0,   0,   6,  36,  62,  77,  93, 109, 125, 139, 150, 157, 160, 159, 154,
+    145, 132, 117, 101,  85,  69,  55,  19,   0,   0,   0,   0,   0,  15,  47,  65,
+     78,  92, 105, 116, 126, 132, 135, 134, 129, 121, 111,  98,  85,  71,  58,  29,
+      3,   0,   0,   0,   0,   0,   0,  19,  49,  64,  75,  86,  95, 103, 108, 110,
+    109, 106,  99,  91,  80,  69,  58,  33,   7,   0,   0,   0,   0,   0,   0,   0,
+      0,  18,  42,  60,  68,  76,  82,  86,  87,  87,  84,  79,  72,  64,  55,  29,
+      7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11,  28,  48,  58,  63,
+     66,  68,  67,  65,  61,  56,  38,  19,   3,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,  11,  22,  32,  39,  42,  41,  36,  27,  17,   6,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   4,   6,   5,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+static const SpriteSpan SPANS_2[400] PROGMEM = {
+    {  9,  6 }, {  6, 12 }, {  5, 14 }, {  4, 16 }, {  3, 18 }, {  2, 20 }, {  1, 22 }, {  1, 22 },
+    {  1, 22 }, {  0, 24 }, {  0, 24 }, {  0, 24 }, {  0, 24 }, {  0, 24 }, {  0, 24 }, {  1, 22 },
+    {  1, 22 }, {  1, 22 }, {  2, 20 }, {  3, 18 }, {  4, 16 }, {  5, 14 }, {  6, 12 }, {  9,  6 },
+    {  0,  0 }, {  9,  7 }, {  7, 11 }, {  5, 15 }, {  4, 17 }, {  3, 19 }, {  2, 20 }, {  2, 21 },
+    {  1, 22 }, {  1, 23 }, {  1, 23 }, {  0, 24 }, {  0, 24 }, {  0, 24 }, {  0, 24 }, {  1, 23 },
+    {  1, 23 }, {  1, 22 }, {  2, 21 }, {  2, 20 }, {  3, 19 }, {  4, 17 }, {  5, 15 }, {  7, 11 },
+    {  9,  7 }, {  0,  0 }, {  9,  7 }, {  7, 11 }, {  5, 15 }, {  4, 17 }, {  3, 19 }, {  2, 21 },
+    {  2, 21 }, {  1, 23 }, {  1, 23 }, {  1, 23 }, {  1, 23 }, {  1, 23 }, {  1, 23 }, {  1, 23 },
+    {  1, 23 }, {  1, 23 }, {  1, 23 }, {  2, 21 }, {  2, 21 }, {  3, 19 }, {  4, 17 }, {  5, 15 },
+    {  7, 11 }, {  9,  7 }, {  0,  0 }, {  9,  7 }, {  7, 11 }, {  5, 15 }, {  4, 17 }, {  3, 19 },
+    {  3, 20 }, {  2, 21 }, {  2, 22 }, {  1, 23 }, {  1, 23 }, {  1, 24 }, {  1, 24 }, {  1, 24 },
+    {  1, 24 }, {  1, 23 }, {  1, 23 }, {  2, 22 }, {  2, 21 }, {  3, 20 }, {  3, 19 }, {  4, 17 },
+    {  5, 15 }, {  7, 11 }, {  9,  7 }, {  0,  0 }, { 10,  4 }, {  7, 10 }, {  5, 14 }, {  4, 16 },
+    {  3, 18 }, {  2, 20 }, {  2, 20 }, {  1, 22 }, {  1, 22 }, {  0, 24 }, {  0, 24 }, {  0, 24 },
+    {  0, 24 }, {  0, 24 }, {  0, 24 }, {  0, 24 }, {  1, 22 }, {  1, 22 }, {  2, 20 }, {  2, 20 },
+    {  3, 18 }, {  4, 16 }, {  6, 12 }, {  8,  8 }, {  0,  0 }, { 10,  4 }, {  7, 10 }, {  5, 14 },
+    {  4, 16 }, {  3, 18 }, {  2, 20 }, {  2, 21 }, {  1, 22 }, {  1, 23 }, {  1, 23 }, {  0, 24 },
+    {  0, 24 }, {  0, 24 }, {  0, 24 }, {  1, 23 }, {  1, 23 }, {  1, 22 }, {  2, 21 }, {  2, 20 },
+    {  3, 19 }, {  4, 17 }, {  5, 15 }, {  6, 12 }, {  8,  8 }, {  0,  0 }, { 10,  5 }, {  7, 11 },
+    {  6, 13 }, {  4, 17 }, {  3, 19 }, {  3, 19 }, {  2, 21 }, {  2, 21 }, {  1, 23 }, {  1, 23 },
+    {  1, 23 }, {  1, 23 }, {  1, 23 }, {  1, 23 }, {  1, 23 }, {  1, 23 }, {  1, 23 }, {  2, 21 },
+    {  2, 21 }, {  3, 19 }, {  4, 17 }, {  5, 15 }, {  6, 13 }, {  8,  9 }, {  0,  0 }, { 11,  4 },
+    {  8, 10 }, {  6, 14 }, {  5, 16 }, {  4, 18 }, {  3, 20 }, {  2, 21 }, {  2, 22 }, {  1, 23 },
+    {  1, 23 }, {  1, 24 }, {  1, 24 }, {  1, 24 }, {  1, 24 }, {  1, 23 }, {  1, 23 }, {  2, 22 },
+    {  2, 21 }, {  3, 20 }, {  3, 19 }, {  4, 17 }, {  5, 15 }, {  7, 12 }, {  9,  8 }, {  0,  0 },
+    {  0,  0 }, {  7, 10 }, {  5, 14 }, {  4, 16 }, {  3, 18 }, {  2, 20 }, {  2, 20 }, {  1, 22 },
+    {  1, 22 }, {  0, 24 }, {  0, 24 }, {  0, 24 }, {  0, 24 }, {  0, 24 }, {  0, 24 }, {  0, 24 },
+    {  1, 22 }, {  1, 22 }, {  2, 20 }, {  2, 20 }, {  3, 18 }, {  4, 16 }, {  5, 14 }, {  7, 10 },
+    {  0,  0 }, {  0,  0 }, {  8,  9 }, {  6, 13 }, {  4, 16 }, {  3, 18 }, {  3, 19 }, {  2, 21 },
+    {  1, 22 }, {  1, 23 }, {  1, 23 }, {  0, 24 }, {  0, 24 }, {  0, 24 }, {  0, 24 }, {  0, 24 },
+    {  1, 23 }, {  1, 23 }, {  1, 22 }, {  2, 21 }, {  3, 19 }, {  3, 18 }, {  4, 16 }, {  6, 13 },
+    {  8,  9 }, {  0,  0 }, {  0,  0 }, {  8,  9 }, {  6, 13 }, {  5, 15 }, {  4, 17 }, {  3, 19 },
+    {  2, 21 }, {  2, 21 }, {  1, 23 }, {  1, 23 }, {  1, 23 }, {  1, 23 }, {  1, 23 }, {  1, 23 },
+    {  1, 23 }, {  1, 23 }, {  1, 23 }, {  2, 21 }, {  2, 21 }, {  3, 19 }, {  4, 17 }, {  5, 15 },
+    {  6, 13 }, {  8,  9 }, {  0,  0 }, {  0,  0 }, {  8,  9 }, {  6, 13 }, {  5, 16 }, {  4, 18 },
+    {  3, 19 }, {  2, 21 }, {  2, 22 }, {  1, 23 }, {  1, 23 }, {  1, 24 }, {  1, 24 }, {  1, 24 },
+    {  1, 24 }, {  1, 24 }, {  1, 23 }, {  1, 23 }, {  2, 22 }, {  2, 21 }, {  3, 19 }, {  4, 18 },
+    {  5, 16 }, {  6, 13 }, {  8,  9 }, {  0,  0 }, {  0,  0 }, {  8,  8 }, {  6, 12 }, {  4, 16 },
+    {  3, 18 }, {  2, 20 }, {  2, 20 }, {  1, 22 }, {  1, 22 }, {  0, 24 }, {  0, 24 }, {  0, 24 },
+    {  0, 24 }, {  0, 24 }, {  0, 24 }, {  0, 24 }, {  1, 22 }, {  1, 22 }, {  2, 20 }, {  2, 20 },
+    {  3, 18 }, {  4, 16 }, {  5, 14 }, {  7, 10 }, { 10,  4 }, {  0,  0 }, {  8,  8 }, {  6, 12 },
+    {  5, 15 }, {  4, 17 }, {  3, 19 }, {  2, 20 }, {  2, 21 }, {  1, 22 }, {  1, 23 }, {  1, 23 },
+    {  0, 24 }, {  0, 24 }, {  0, 24 }, {  0, 24 }, {  1, 23 }, {  1, 23 }, {  1, 22 }, {  2, 21 },
+    {  2, 20 }, {  3, 18 }, {  4, 16 }, {  5, 14 }, {  7, 10 }, { 10,  4 }, {  0,  0 }, {  8,  9 },
+    {  6, 13 }, {  5, 15 }, {  4, 17 }, {  3, 19 }, {  2, 21 }, {  2, 21 }, {  1, 23 }, {  1, 23 },
+    {  1, 23 }, {  1, 23 }, {  1, 23 }, {  1, 23 }, {  1, 23 }, {  1, 23 }, {  1, 23 }, {  2, 21 },
+    {  2, 21 }, {  3, 19 }, {  3, 19 }, {  4, 17 }, {  6, 13 }, {  7, 11 }, { 10,  5 }, {  0,  0 },
+    {  9,  8 }, {  7, 12 }, {  5, 15 }, {  4, 17 }, {  3, 19 }, {  3, 20 }, {  2, 21 }, {  2, 22 },
+    {  1, 23 }, {  1, 23 }, {  1, 24 }, {  1, 24 }, {  1, 24 }, {  1, 24 }, {  1, 23 }, {  1, 23 },
+    {  2, 22 }, {  2, 21 }, {  3, 20 }, {  4, 18 }, {  5, 16 }, {  6, 14 }, {  8, 10 }, { 11,  4 },
+};
+
+const uint8_t* const SPRITE_TABLE_ALPHA[NUM_PARTICLE_SIZES] = { ALPHA_0, ALPHA_1, ALPHA_2 };
+const SpriteSpan* const SPRITE_TABLE_SPANS[NUM_PARTICLE_SIZES] = { SPANS_0, SPANS_1, SPANS_2 };
@@ -0,0 +1,24 @@
+/**
+ * Ada Particles - Baked Particle Sprites
+ *
+ * Generated by bench/bake_sprites from ParticleSprites::compute();
+ * do not edit. After changing the sprite sizes, sigmas or sub-pixel
+ * phases, regenerate them with
+ *
+ *   build/bench/bake_sprites --write firmware/src
+ *
+ * Until then the firmware computes its sprites at boot, and the
+ * bench's ctest fails.
+ */
+
+#ifndef SPRITE_TABLES_H
+#define SPRITE_TABLES_H
+
+#include <stdint.h>
+
+// Sprite configuration the tables were baked for
+#define SPRITE_TABLES_SUBPIXEL_SHIFT 2
+static constexpr uint8_t SPRITE_TABLES_DIAMETER[3] = { 8, 16, 24 };
+static constexpr float SPRITE_TABLES_SIGMA[3] = { 2.5f, 4.0f, 6.0f };
+
+#endif // SPRITE_TABLES_H
@@ -3,30 +3,23 @@
  */
 
 #include "sprites.h"
+#include "memory_arena.h"
 #include <math.h>
 
 // Global instance
 ParticleSprites particleSprites;
 
 // ============================================
-// Constructor / Destructor
+// Constructor
 // ============================================
 
 ParticleSprites::ParticleSprites() 
     : _ready(false), _memoryUsed(0) {
     memset(_sprites, 0, sizeof(_sprites));
-    _sizes[0] = PARTICLE_SIZE_SMALL;   // 8px
-    _sizes[1] = PARTICLE_SIZE_MEDIUM;  // 16px
-    _sizes[2] = PARTICLE_SIZE_LARGE;   // 24px
-}
-
-ParticleSprites::~ParticleSprites() {
-    for (int i = 0; i < NUM_PARTICLE_SIZES; i++) {
-        if (_sprites[i]) {
-            free(_sprites[i]);
-            _sprites[i] = nullptr;
-        }
-    }
+    memset(_spans, 0, sizeof(_spans));
+    _sizes[0] = SPRITE_DIAMETER(PARTICLE_SIZE_SMALL);   // 8px
+    _sizes[1] = SPRITE_DIAMETER(PARTICLE_SIZE_MEDIUM);  // 16px
+    _sizes[2] = SPRITE_DIAMETER(PARTICLE_SIZE_LARGE);   // 24px
 }
 
 // ============================================
@@ -34,32 +27,70 @@ ParticleSprites::~ParticleSprites() {
 // ============================================
 
 bool ParticleSprites::generate() {
-    Serial.println("Generating particle sprites...");
+    if (!spriteTablesMatch()) {
+        return compute();
+    }
+    
+    _memoryUsed = 0;
+    
+    for (int i = 0; i < NUM_PARTICLE_SIZES; i++) {
+        size_t spanBytes = SPRITE_SPAN_BYTES(_sizes[i]);
+        
+        // Alpha maps are read in place from flash; spans are small and
+        // read for every particle, so they move to internal RAM
+        _sprites[i] = SPRITE_TABLE_ALPHA[i];
+        _spans[i] = (SpriteSpan*)memoryArena.alloc(ARENA_SPRITES, spanBytes, ARENA_INTERNAL);
+        
+        if (!_spans[i]) {
+            Serial.printf("ERROR: Failed to generate sprite %d\n", i);
+            return false;
+        }
+        
+        memcpy(_spans[i], SPRITE_TABLE_SPANS[i], spanBytes);
+        _memoryUsed += spanBytes;
+    }
     
-    // Sigma values for each size (controls softness)
-    // Smaller sigma = sharper center, faster falloff
-    // Larger sigma = softer overall
-    float sigmas[3] = {
-        2.5f,   // Small: tighter glow
-        4.0f,   // Medium: balanced
-        6.0f    // Large: very soft
-    };
+    Serial.printf("Sprites ready: baked (%d bytes)\n", _memoryUsed);
+    _ready = true;
+    return true;
+}
+
+bool ParticleSprites::compute() {
+    Serial.println("Generating particle sprites...");
     
     _memoryUsed = 0;
     
     for (int i = 0; i < NUM_PARTICLE_SIZES; i++) {
-        _sprites[i] = generateSprite(_sizes[i], sigmas[i]);
+        uint8_t grid = SPRITE_GRID(_sizes[i]);
+        size_t phaseBytes = grid * grid;
+        size_t spriteBytes = SPRITE_ALPHA_BYTES(_sizes[i]);
+        size_t spanBytes = SPRITE_SPAN_BYTES(_sizes[i]);
         
-        if (!_sprites[i]) {
+        // Alpha maps in PSRAM
+        uint8_t* alpha = (uint8_t*)memoryArena.alloc(ARENA_SPRITES, spriteBytes, ARENA_PSRAM);
+        
+        // Spans are small and read for every particle: internal RAM
+        _spans[i] = (SpriteSpan*)memoryArena.alloc(ARENA_SPRITES, spanBytes, ARENA_INTERNAL);
+        
+        if (!alpha || !_spans[i]) {
             Serial.printf("ERROR: Failed to generate sprite %d\n", i);
             return false;
         }
         
-        size_t spriteBytes = _sizes[i] * _sizes[i];
-        _memoryUsed += spriteBytes;
+        for (int phase = 0; phase < SPRITE_PHASES; phase++) {
+            float offsetX = (float)(phase % SPRITE_SUBPIXEL_STEPS) / SPRITE_SUBPIXEL_STEPS;
+            float offsetY = (float)(phase / SPRITE_SUBPIXEL_STEPS) / SPRITE_SUBPIXEL_STEPS;
+            uint8_t* sprite = &alpha[phase * phaseBytes];
+            
+            generateSprite(sprite, _sizes[i], SPRITE_SCALED_SIGMA(i), offsetX, offsetY);
+            generateSpans(&_spans[i][phase * grid], sprite, grid);
+        }
         
-        Serial.printf("  Sprite %d: %dx%d (%d bytes)\n", 
-                      i, _sizes[i], _sizes[i], spriteBytes);
+        _sprites[i] = alpha;
+        _memoryUsed += spriteBytes + spanBytes;
+        
+        Serial.printf("  Sprite %d: %dx%d x %d phases (%d bytes)\n", 
+                      i, grid, grid, SPRITE_PHASES, spriteBytes + spanBytes);
     }
     
     Serial.printf("Sprites ready: %d bytes total\n", _memoryUsed);
@@ -67,28 +98,22 @@ bool ParticleSprites::generate() {
     return true;
 }
 
-uint8_t* ParticleSprites::generateSprite(uint8_t diameter, float sigma) {
-    size_t pixels = diameter * diameter;
-    
-    // Allocate in PSRAM
-    uint8_t* sprite = (uint8_t*)ps_malloc(pixels);
-    if (!sprite) {
-        sprite = (uint8_t*)malloc(pixels);
-    }
-    if (!sprite) return nullptr;
+void ParticleSprites::generateSprite(uint8_t* sprite, uint8_t diameter, float sigma,
+                                     float offsetX, float offsetY) {
+    uint8_t grid = SPRITE_GRID(diameter);
     
     float radius = diameter / 2.0f;
-    float centerX = radius - 0.5f;
-    float centerY = radius - 0.5f;
+    float centerX = radius - 0.5f + offsetX;
+    float centerY = radius - 0.5f + offsetY;
     
     // Pre-calculate Gaussian coefficient
     // G(d) = exp(-d²/(2σ²))
     float sigma2 = 2.0f * sigma * sigma;
     
-    for (int y = 0; y < diameter; y++) {
+    for (int y = 0; y < grid; y++) {
         float dy = y - centerY;
         
-        for (int x = 0; x < diameter; x++) {
+        for (int x = 0; x < grid; x++) {
             float dx = x - centerX;
             
             // Distance from center
@@ -110,23 +135,114 @@ uint8_t* ParticleSprites::generateSprite(uint8_t diameter, float sigma) {
             
             // Clamp and convert to 8-bit
             intensity = fmaxf(0.0f, fminf(1.0f, intensity));
-            sprite[y * diameter + x] = (uint8_t)(intensity * 255.0f);
+            sprite[y * grid + x] = (uint8_t)(intensity * 255.0f);
         }
     }
-    
-    return sprite;
+}
+
+void ParticleSprites::generateSpans(SpriteSpan* spans, const uint8_t* sprite, uint8_t grid) {
+    for (int y = 0; y < grid; y++) {
+        const uint8_t* row = &sprite[y * grid];
+        int first = 0;
+        int last = grid - 1;
+        
+        while (first < grid && row[first] == 0) first++;
+        while (last >= first && row[last] == 0) last--;
+        
+        // A Gaussian disc covers one contiguous run per row
+        spans[y].start = (first < grid) ? first : 0;
+        spans[y].length = (first < grid) ? (last - first + 1) : 0;
+    }
 }
 
 // ============================================
 // Accessors
 // ============================================
 
-const uint8_t* ParticleSprites::getSprite(uint8_t sizeIdx) const {
-    if (sizeIdx >= NUM_PARTICLE_SIZES || !_ready) return nullptr;
-    return _sprites[sizeIdx];
+const uint8_t* ParticleSprites::getSprite(uint8_t sizeIdx, uint8_t phase) const {
+    if (sizeIdx >= NUM_PARTICLE_SIZES || phase >= SPRITE_PHASES || !_ready) return nullptr;
+    uint8_t grid = SPRITE_GRID(_sizes[sizeIdx]);
+    return &_sprites[sizeIdx][phase * grid * grid];
+}
+
+const SpriteSpan* ParticleSprites::getSpans(uint8_t sizeIdx, uint8_t phase) const {
+    if (sizeIdx >= NUM_PARTICLE_SIZES || phase >= SPRITE_PHASES || !_ready) return nullptr;
+    return &_spans[sizeIdx][phase * SPRITE_GRID(_sizes[sizeIdx])];
 }
 
 uint8_t ParticleSprites::getSpriteSize(uint8_t sizeIdx) const {
     if (sizeIdx >= NUM_PARTICLE_SIZES) return 0;
     return _sizes[sizeIdx];
 }
+
+// ============================================
+// Shape Sprites
+// ============================================
+
+ShapeSprites::ShapeSprites() : _memoryUsed(0) {
+    memset(_alpha, 0, sizeof(_alpha));
+    memset(_spans, 0, sizeof(_spans));
+}
+
+bool ShapeSprites::generate() {
+    _memoryUsed = 0;
+    
+    for (int shape = 0; shape < NUM_SPRITE_SHAPES; shape++) {
+        for (int r = 1; r <= SHAPE_SPRITE_MAX_RADIUS; r++) {
+            int grid = (shape == SPRITE_SHAPE_CIRCLE) ? 2 * r + 1 : 2 * r;
+            // Only the image engine draws shapes
+            uint8_t* alpha = (uint8_t*)memoryArena.alloc(ARENA_IMAGE_ENGINE, grid * grid, ARENA_INTERNAL);
+            SpriteSpan* spans = (SpriteSpan*)memoryArena.alloc(ARENA_IMAGE_ENGINE, grid * sizeof(SpriteSpan),
+                                                               ARENA_INTERNAL);
+            
+            if (!alpha || !spans) {
+                Serial.println("ERROR: Failed to allocate shape sprites");
+                return false;
+            }
+            
+            for (int y = 0; y < grid; y++) {
+                int first = grid;
+                int last = -1;
+                
+                for (int x = 0; x < grid; x++) {
+                    uint8_t a = 255;
+                    
+                    if (shape == SPRITE_SHAPE_CIRCLE) {
+                        // Coverage falls off over the last pixel of the radius
+                        float dx = x - r;
+                        float dy = y - r;
+                        float edge = r + 0.5f - sqrtf(dx * dx + dy * dy);
+                        a = (uint8_t)(fmaxf(0.0f, fminf(1.0f, edge)) * 255.0f);
+                    }
+                    
+                    alpha[y * grid + x] = a;
+                    if (a) {
+                        if (first == grid) first = x;
+                        last = x;
+                    }
+                }
+                
+                spans[y].start = (last >= 0) ? first : 0;
+                spans[y].length = (last >= 0) ? (last - first + 1) : 0;
+            }
+            
+            _alpha[shape][r - 1] = alpha;
+            _spans[shape][r - 1] = spans;
+            _memoryUsed += grid * grid + grid * sizeof(SpriteSpan);
+        }
+    }
+    
+    Serial.printf("Shape sprites ready: %d bytes\n", _memoryUsed);
+    return true;
+}
+
+SpriteRef ShapeSprites::get(uint8_t shape, uint8_t radius) const {
+    if (shape >= NUM_SPRITE_SHAPES) shape = SPRITE_SHAPE_CIRCLE;
+    radius = constrain(radius >> FB_RENDER_SHIFT, 1, SHAPE_SPRITE_MAX_RADIUS);
+    
+    SpriteRef ref;
+    ref.alpha = _alpha[shape][radius - 1];
+    ref.spans = _spans[shape][radius - 1];
+    ref.size = (shape == SPRITE_SHAPE_CIRCLE) ? 2 * radius + 1 : 2 * radius;
+    return ref;
+}
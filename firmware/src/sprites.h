@@ -4,6 +4,19 @@
  * Generates Gaussian-falloff circular sprites at boot time.
  * These provide the soft, anti-aliased particle look without
  * expensive per-pixel calculations during rendering.
+ * 
+ * Alongside each dense alpha map, every row's covered texels are
+ * stored as a [start, length] span so blitters can skip the
+ * transparent corners without testing each texel.
+ * 
+ * Each size is rendered SPRITE_PHASES times, with the Gaussian center
+ * shifted by every sub-pixel offset, on a SPRITE_GRID(diameter) grid.
+ * The phases of one size are stored back to back, so phase p of a
+ * grid-g sprite starts at texel p * g * g and span row p * g.
+ * 
+ * The default configuration's sprites are baked into flash
+ * (sprite_tables.h/cpp, generated by bench/bake_sprites), so boot
+ * skips the Gaussians. Any other configuration computes them at boot.
  */
 
 #ifndef SPRITES_H
@@ -11,37 +24,105 @@
 
 #include <Arduino.h>
 #include "../config.h"
+#include "sprite_tables.h"
 
 // ============================================
 // Sprite System
 // ============================================
 
+// Non-zero alpha texels of one sprite row (length 0 = empty row)
+struct SpriteSpan {
+    uint8_t start;
+    uint8_t length;
+};
+
+// Gaussian sigma of each size at full render scale: a smaller sigma
+// gives a sharper center and faster falloff
+static constexpr float SPRITE_SIGMA[NUM_PARTICLE_SIZES] = {
+    2.5f,   // Small: tighter glow
+    4.0f,   // Medium: balanced
+    6.0f    // Large: very soft
+};
+
+// Sigma at the current render scale (same look at a reduced scale)
+#define SPRITE_SCALED_SIGMA(i) (SPRITE_SIGMA[i] / (1 << FB_RENDER_SHIFT))
+
+/**
+ * Check if the baked tables were made for this configuration.
+ */
+constexpr bool spriteTablesMatch() {
+    return SPRITE_TABLES_SUBPIXEL_SHIFT == SPRITE_SUBPIXEL_SHIFT &&
+           SPRITE_TABLES_DIAMETER[0] == SPRITE_DIAMETER(PARTICLE_SIZE_SMALL) &&
+           SPRITE_TABLES_DIAMETER[1] == SPRITE_DIAMETER(PARTICLE_SIZE_MEDIUM) &&
+           SPRITE_TABLES_DIAMETER[2] == SPRITE_DIAMETER(PARTICLE_SIZE_LARGE) &&
+           SPRITE_TABLES_SIGMA[0] == SPRITE_SCALED_SIGMA(0) &&
+           SPRITE_TABLES_SIGMA[1] == SPRITE_SCALED_SIGMA(1) &&
+           SPRITE_TABLES_SIGMA[2] == SPRITE_SCALED_SIGMA(2);
+}
+
+// Bytes of one size's alpha maps and spans, all phases
+#define SPRITE_ALPHA_BYTES(d) (SPRITE_GRID(d) * SPRITE_GRID(d) * SPRITE_PHASES)
+#define SPRITE_SPAN_BYTES(d) (SPRITE_GRID(d) * SPRITE_PHASES * sizeof(SpriteSpan))
+
+// A sprite to blit: alpha map plus one span per row, size x size
+struct SpriteRef {
+    const uint8_t* alpha;
+    const SpriteSpan* spans;
+    uint8_t size;
+};
+
+/**
+ * Sub-pixel phase of a 16.16 fixed-point position.
+ * @return Phase index (y phase * SPRITE_SUBPIXEL_STEPS + x phase)
+ */
+inline uint8_t spritePhase(int32_t x, int32_t y) {
+    const int shift = 16 - SPRITE_SUBPIXEL_SHIFT;
+    const int32_t mask = SPRITE_SUBPIXEL_STEPS - 1;
+    return (((y >> shift) & mask) << SPRITE_SUBPIXEL_SHIFT) | ((x >> shift) & mask);
+}
+
 class ParticleSprites {
 public:
     ParticleSprites();
-    ~ParticleSprites();
     
     /**
-     * Generate particle sprites in PSRAM.
+     * Set up the particle sprites: the baked tables if they match
+     * the configuration, else compute().
      * Call once at startup after PSRAM is available.
      * @return true if allocation and generation succeeded
      */
     bool generate();
     
+    /**
+     * Compute every sprite in PSRAM, whether or not baked tables
+     * match (the tables are baked from this).
+     * @return true if allocation succeeded
+     */
+    bool compute();
+    
     /**
      * Get pointer to a sprite's alpha data.
      * @param sizeIdx 0=small, 1=medium, 2=large
+     * @param phase Sub-pixel phase (see spritePhase())
      * @return Pointer to sprite alpha map, or nullptr
      */
-    const uint8_t* getSprite(uint8_t sizeIdx) const;
+    const uint8_t* getSprite(uint8_t sizeIdx, uint8_t phase = 0) const;
     
     /**
-     * Get sprite diameter.
+     * Get sprite diameter (the stored grid is SPRITE_GRID(diameter)).
      * @param sizeIdx 0=small, 1=medium, 2=large
      * @return Sprite diameter in pixels
      */
     uint8_t getSpriteSize(uint8_t sizeIdx) const;
     
+    /**
+     * Get a sprite's row spans (one per grid row).
+     * @param sizeIdx 0=small, 1=medium, 2=large
+     * @param phase Sub-pixel phase (see spritePhase())
+     * @return Pointer to span table, or nullptr
+     */
+    const SpriteSpan* getSpans(uint8_t sizeIdx, uint8_t phase = 0) const;
+    
     /**
      * Get array of all sprite pointers (for Framebuffer).
      */
@@ -52,32 +133,99 @@ public:
      */
     const uint8_t* getSizesArray() const { return _sizes; }
     
+    /**
+     * Get array of all span tables (for Framebuffer).
+     */
+    const SpriteSpan** getSpansArray() const { return (const SpriteSpan**)_spans; }
+    
     /**
      * Check if sprites are ready.
      */
     bool isReady() const { return _ready; }
     
     /**
-     * Get total memory used by sprites.
+     * Get total memory used by sprites (all phases and spans).
      */
     size_t getMemoryUsage() const { return _memoryUsed; }
 
 private:
-    uint8_t* _sprites[NUM_PARTICLE_SIZES];
+    const uint8_t* _sprites[NUM_PARTICLE_SIZES];
+    SpriteSpan* _spans[NUM_PARTICLE_SIZES];
     uint8_t _sizes[NUM_PARTICLE_SIZES];
     bool _ready;
     size_t _memoryUsed;
     
     /**
-     * Generate a single sprite with Gaussian falloff.
+     * Render one sprite phase with Gaussian falloff.
+     * @param sprite Destination, SPRITE_GRID(diameter)² bytes
      * @param diameter Sprite diameter in pixels
      * @param sigma Gaussian sigma (controls softness)
-     * @return Pointer to allocated sprite, or nullptr
+     * @param offsetX Sub-pixel shift of the center (0 to <1)
+     * @param offsetY Sub-pixel shift of the center (0 to <1)
+     */
+    void generateSprite(uint8_t* sprite, uint8_t diameter, float sigma,
+                        float offsetX, float offsetY);
+    
+    /**
+     * Build the row spans of one generated sprite phase.
+     * @param spans Destination, one span per grid row
+     * @param sprite Dense alpha map
+     * @param grid Sprite grid width in pixels
      */
-    uint8_t* generateSprite(uint8_t diameter, float sigma);
+    void generateSpans(SpriteSpan* spans, const uint8_t* sprite, uint8_t grid);
 };
 
 // Global instance
 extern ParticleSprites particleSprites;
 
+// Baked alpha maps and spans per size (sprite_tables.cpp), for when
+// spriteTablesMatch()
+extern const uint8_t* const SPRITE_TABLE_ALPHA[NUM_PARTICLE_SIZES];
+extern const SpriteSpan* const SPRITE_TABLE_SPANS[NUM_PARTICLE_SIZES];
+
+// ============================================
+// Shape Sprites
+// ============================================
+
+enum SpriteShape : uint8_t {
+    SPRITE_SHAPE_CIRCLE = 0,    // (2r + 1) grid, anti-aliased edge
+    SPRITE_SHAPE_SQUARE,        // 2r grid, solid
+    NUM_SPRITE_SHAPES
+};
+
+#define SHAPE_SPRITE_MAX_RADIUS 8
+
+/**
+ * Solid shape sprites, one per shape and integer radius
+ * (1..SHAPE_SPRITE_MAX_RADIUS), for engines that draw sized,
+ * per-particle colored shapes through Framebuffer::drawSprite().
+ */
+class ShapeSprites {
+public:
+    ShapeSprites();
+    
+    /**
+     * Generate every shape and radius (internal RAM, ~2 KB).
+     * @return true if allocation succeeded
+     */
+    bool generate();
+    
+    /**
+     * Get a shape sprite; the radius is clamped to the generated range.
+     * A radius-r sprite is drawn with its top-left at (cx - r, cy - r).
+     * Radii are screen pixels; the sprite is scaled by FB_RENDER_SHIFT.
+     */
+    SpriteRef get(uint8_t shape, uint8_t radius) const;
+    
+    /**
+     * Get total memory used by shape sprites.
+     */
+    size_t getMemoryUsage() const { return _memoryUsed; }
+
+private:
+    uint8_t* _alpha[NUM_SPRITE_SHAPES][SHAPE_SPRITE_MAX_RADIUS];
+    SpriteSpan* _spans[NUM_SPRITE_SHAPES][SHAPE_SPRITE_MAX_RADIUS];
+    size_t _memoryUsed;
+};
+
 #endif // SPRITES_H